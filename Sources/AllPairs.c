@@ -0,0 +1,183 @@
+#include "AllPairs.h"
+#include "Search.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * Per-thread scratch reused across rows: search state, priority queue
+ * (NULL for queue-free metrics) and the encoded row.
+ */
+struct MatrixWorker {
+    struct SearchState* state;
+    struct PriorityQueue* queue;
+    void* row;
+};
+
+/**
+ * Shared state of an all-pairs run. Every row goes to its own offset of the
+ * file, so rows can be finished in any order and the bytes written do not
+ * depend on the number of threads.
+ */
+struct MatrixRun {
+    const struct Graph* graph;
+    const struct Metric* metric;
+    bool isLazy;
+    int firstSourceId;
+    enum MatrixFormat format;
+    size_t rowBytes;
+    struct MatrixWorker* workers;
+    int fileDescriptor;
+    const char* fileName;
+};
+
+// Private Methods:
+static inline double MatrixEntry(const struct SearchState* state, const int index)
+{
+    if (state -> weights[index] == state -> unreachableWeight || state -> heapIndices[index] != SETTLED)
+        return -1;
+    return state -> weights[index];
+}
+
+static void WriteRowTask(void* context, const int taskIndex, const int threadIndex)
+{
+    struct MatrixRun* run = (struct MatrixRun*) context;
+    struct MatrixWorker* worker = &run -> workers[threadIndex];
+    struct SearchState* state = worker -> state;
+    const int numberOfVertices = run -> graph -> numberOfVertices;
+
+    ResetSearchState(state, run -> firstSourceId + taskIndex); // ! O(touched vertices)
+    RunMetricQuery(run -> metric, run -> graph, state, worker -> queue, run -> isLazy, -1);
+    if (run -> format == MATRIX_FLOAT32)
+    {
+        float* row = (float*) worker -> row;
+        for (int index = 0 ; index < numberOfVertices ; index++)
+            row[index] = (float) MatrixEntry(state, index);
+    }
+    else
+    {
+        double* row = (double*) worker -> row;
+        for (int index = 0 ; index < numberOfVertices ; index++)
+            row[index] = MatrixEntry(state, index);
+    }
+
+    const char* bytes = (const char*) worker -> row;
+    off_t offset = (off_t) taskIndex * run -> rowBytes;
+    size_t remaining = run -> rowBytes;
+    while (remaining > 0)
+    {
+        ssize_t written = pwrite(run -> fileDescriptor, bytes, remaining, offset);
+        if (written <= 0)
+        {
+            fprintf(stderr, "Cannot write row %d to %s\n", run -> firstSourceId + taskIndex, run -> fileName);
+            exit(-1);
+        }
+        bytes += written;
+        offset += written;
+        remaining -= written;
+    }
+}
+
+// Public Methods:
+/**
+ * @brief Parse a matrix element type name (float32 or float64)
+ * ! Complexity: O(1)
+ * @param name 
+ * @param format 
+ * @return true if the name is known
+ */
+bool ParseMatrixFormat(const char* name, enum MatrixFormat* format)
+{
+    if (strcmp(name, "float32") == 0)
+        *format = MATRIX_FLOAT32;
+    else if (strcmp(name, "float64") == 0)
+        *format = MATRIX_FLOAT64;
+    else
+        return false;
+    return true;
+}
+
+/**
+ * @brief Parse a row range "first:last" of source vertices (both inclusive, 1-based)
+ * ! Complexity: O(1)
+ * @param text 
+ * @param firstSourceId 
+ * @param lastSourceId 
+ * @return true if the text is a well-formed range
+ */
+bool ParseRowRange(const char* text, int* firstSourceId, int* lastSourceId)
+{
+    char trailing;
+    return sscanf(text, "%d:%d%c", firstSourceId, lastSourceId, &trailing) == 2 && *firstSourceId <= *lastSourceId;
+}
+
+/**
+ * @brief Run a full search from every source in [firstSourceId, lastSourceId] on the pool
+ * (work stealing, one reusable search state and queue per thread) and write the rows
+ * of the weight matrix to the given file
+ * ! Complexity: O(rows * (V + E)lgV / threads)
+ * @param graph 
+ * @param metric 
+ * @param queueBackend (NULL: the metric's queue-free search)
+ * @param isLazy 
+ * @param firstSourceId 
+ * @param lastSourceId 
+ * @param format 
+ * @param pool 
+ * @param fileName 
+ */
+void WriteAllPairsMatrix(const struct Graph* graph, const struct Metric* metric, const struct QueueOperations* queueBackend, const bool isLazy, const int firstSourceId, const int lastSourceId, const enum MatrixFormat format, struct ThreadPool* pool, const char* fileName)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    if (firstSourceId < 1 || lastSourceId > numberOfVertices || firstSourceId > lastSourceId)
+    {
+        fprintf(stderr, "Row range %d:%d must lie within 1:%d\n", firstSourceId, lastSourceId, numberOfVertices);
+        exit(-1);
+    }
+    struct MatrixRun run;
+    run.graph = graph;
+    run.metric = metric;
+    run.isLazy = isLazy;
+    run.firstSourceId = firstSourceId;
+    run.format = format;
+    run.rowBytes = (size_t) numberOfVertices * (format == MATRIX_FLOAT32 ? sizeof(float) : sizeof(double));
+    run.fileName = fileName;
+    run.fileDescriptor = open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (run.fileDescriptor < 0)
+    {
+        fprintf(stderr, "Cannot open file %s\n", fileName);
+        exit(-1);
+    }
+    const int numberOfRows = lastSourceId - firstSourceId + 1;
+    if (ftruncate(run.fileDescriptor, (off_t) numberOfRows * run.rowBytes) != 0)
+    {
+        fprintf(stderr, "Cannot resize %s to %d rows\n", fileName, numberOfRows);
+        exit(-1);
+    }
+
+    const int numberOfThreads = pool -> numberOfThreads;
+    run.workers = (struct MatrixWorker*) malloc(numberOfThreads * sizeof(struct MatrixWorker));
+    for (int threadIndex = 0 ; threadIndex < numberOfThreads ; threadIndex++)
+    {
+        struct MatrixWorker* worker = &run.workers[threadIndex];
+        worker -> state = CreateSearchStateForMetric(metric, numberOfVertices);
+        worker -> queue = queueBackend != NULL ? CreatePriorityQueue(queueBackend, numberOfVertices) : NULL;
+        worker -> row = malloc(run.rowBytes);
+    }
+    RunTasksWithStealing(pool, numberOfRows, WriteRowTask, &run);
+    for (int threadIndex = 0 ; threadIndex < numberOfThreads ; threadIndex++)
+    {
+        struct MatrixWorker* worker = &run.workers[threadIndex];
+        DestroySearchState(worker -> state);
+        if (worker -> queue != NULL)
+            DestroyPriorityQueue(worker -> queue);
+        free(worker -> row);
+    }
+    free(run.workers);
+    if (close(run.fileDescriptor) != 0)
+    {
+        fprintf(stderr, "Cannot close file %s\n", fileName);
+        exit(-1);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#ifndef __ALLPAIRS_H__
+#define __ALLPAIRS_H__
+#include "Graph.h"
+#include "Dijkstra.h"
+#include "PriorityQueue.h"
+#include "ThreadPool.h"
+#include <stdbool.h>
+
+/**
+ * All-pairs matrix file: rows firstSourceId .. lastSourceId of the V x V
+ * weight matrix, row-major, no header, native-endian float32 or float64.
+ * Entry (s, v) is the weight of the best path from s to v, or -1 when v
+ * is unreachable (the fill-file convention). Shards written for adjacent
+ * row ranges concatenate into the full matrix.
+ */
+enum MatrixFormat {
+    MATRIX_FLOAT32,
+    MATRIX_FLOAT64
+};
+
+// Public Methods:
+bool ParseMatrixFormat(const char* name, enum MatrixFormat* format);
+
+bool ParseRowRange(const char* text, int* firstSourceId, int* lastSourceId);
+
+void WriteAllPairsMatrix(const struct Graph* graph, const struct Metric* metric, const struct QueueOperations* queueBackend, const bool isLazy, const int firstSourceId, const int lastSourceId, const enum MatrixFormat format, struct ThreadPool* pool, const char* fileName);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "Arena.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Header of a block; its bytes follow it. Blocks are chained newest first, so
+ * the arena only ever allocates from the head.
+ */
+struct ArenaBlock {
+    struct ArenaBlock* previous;
+    size_t size;
+    size_t used;
+};
+
+// Private Methods:
+/**
+ * @brief Chain a new block with room for at least bytes aligned bytes in front of the others
+ * ! Complexity: O(1)
+ * @param arena 
+ * @param bytes 
+ */
+static void AddArenaBlock(struct Arena* arena, const size_t bytes)
+{
+    // The slack lets the first allocation be aligned wherever malloc puts the block
+    const size_t size = (bytes > arena -> blockBytes ? bytes : arena -> blockBytes) + ARENA_ALIGNMENT;
+    struct ArenaBlock* block = (struct ArenaBlock*) malloc(sizeof(struct ArenaBlock) + size);
+    if (block == NULL)
+    {
+        fprintf(stderr, "Cannot allocate an arena block of %zu bytes\n", size);
+        exit(-1);
+    }
+    block -> previous = arena -> block;
+    block -> size = size;
+    block -> used = 0;
+    arena -> block = block;
+    arena -> reservedBytes += size;
+}
+
+// Public Methods:
+/**
+ * @brief Create an empty Arena that reserves memory in blocks of blockBytes (larger
+ * allocations get a block of their own); no memory is reserved until the first allocation
+ * ! Complexity: O(1)
+ * @param blockBytes 
+ * @return struct Arena* 
+ */
+struct Arena* CreateArena(const size_t blockBytes)
+{
+    struct Arena* arena = (struct Arena*) malloc(sizeof(struct Arena));
+    arena -> block = NULL;
+    arena -> blockBytes = blockBytes > 0 ? blockBytes : ARENA_ALIGNMENT;
+    arena -> usedBytes = 0;
+    arena -> peakBytes = 0;
+    arena -> reservedBytes = 0;
+    return arena;
+}
+
+/**
+ * @brief Allocate bytes from an Arena, aligned to ARENA_ALIGNMENT; the memory is not cleared
+ * ! Complexity: O(1)
+ * @param arena 
+ * @param bytes 
+ * @return void* 
+ */
+void* ArenaAllocate(struct Arena* arena, const size_t bytes)
+{
+    const size_t alignedBytes = ARENA_BYTES(bytes > 0 ? bytes : 1);
+    struct ArenaBlock* block = arena -> block;
+    uintptr_t start = 0;
+    if (block != NULL)
+    {
+        const uintptr_t base = (uintptr_t) (block + 1);
+        start = (base + block -> used + ARENA_ALIGNMENT - 1) & ~((uintptr_t) ARENA_ALIGNMENT - 1);
+    }
+    if (block == NULL || start + alignedBytes > (uintptr_t) (block + 1) + block -> size)
+    {
+        AddArenaBlock(arena, alignedBytes);
+        block = arena -> block;
+        start = ((uintptr_t) (block + 1) + ARENA_ALIGNMENT - 1) & ~((uintptr_t) ARENA_ALIGNMENT - 1);
+    }
+    block -> used = start + alignedBytes - (uintptr_t) (block + 1);
+    arena -> usedBytes += alignedBytes;
+    if (arena -> usedBytes > arena -> peakBytes)
+        arena -> peakBytes = arena -> usedBytes;
+    return (void*) start;
+}
+
+/**
+ * @brief Allocate bytes from an Arena like ArenaAllocate and clear them
+ * ! Complexity: O(bytes)
+ * @param arena 
+ * @param bytes 
+ * @return void* 
+ */
+void* ArenaAllocateZeroed(struct Arena* arena, const size_t bytes)
+{
+    void* memory = ArenaAllocate(arena, bytes);
+    memset(memory, 0, bytes);
+    return memory;
+}
+
+/**
+ * @brief Get the current position of the cursor of an Arena
+ * ! Complexity: O(1)
+ * @param arena 
+ * @return struct ArenaMark 
+ */
+struct ArenaMark ArenaGetMark(const struct Arena* arena)
+{
+    struct ArenaMark mark;
+    mark.block = arena -> block;
+    mark.blockUsed = arena -> block != NULL ? arena -> block -> used : 0;
+    mark.usedBytes = arena -> usedBytes;
+    return mark;
+}
+
+/**
+ * @brief Free everything allocated from an Arena since the mark was taken: blocks chained
+ * after it go back to the system and the cursor returns to the mark. peakBytes keeps the
+ * high-water mark.
+ * ! Complexity: O(blocks released)
+ * @param arena 
+ * @param mark 
+ */
+void ArenaRelease(struct Arena* arena, const struct ArenaMark mark)
+{
+    while (arena -> block != mark.block)
+    {
+        struct ArenaBlock* block = arena -> block;
+        arena -> block = block -> previous;
+        arena -> reservedBytes -= block -> size;
+        free(block);
+    }
+    if (arena -> block != NULL)
+        arena -> block -> used = mark.blockUsed;
+    arena -> usedBytes = mark.usedBytes;
+}
+
+/**
+ * @brief Deallocate and Destroy an Arena Object along with everything allocated from it
+ * ! Complexity: O(blocks)
+ * @param arena 
+ */
+void DestroyArena(struct Arena* arena)
+{
+    struct ArenaBlock* block = arena -> block;
+    while (block != NULL)
+    {
+        struct ArenaBlock* previous = block -> previous;
+        free(block);
+        block = previous;
+    }
+    free(arena);
+}
\ No newline at end of file
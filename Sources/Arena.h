@@ -0,0 +1,52 @@
+#ifndef __ARENA_H__
+#define __ARENA_H__
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// Every allocation starts on its own cache line
+#define ARENA_ALIGNMENT 64
+// Bytes an allocation of the given size takes in an arena, so exact arena sizes can be summed up
+#define ARENA_BYTES(bytes) ((((size_t) (bytes)) + ARENA_ALIGNMENT - 1) & ~((size_t) ARENA_ALIGNMENT - 1))
+
+struct ArenaBlock;
+
+/**
+ * Bump allocator for data that lives and dies together: a graph's arrays, the
+ * scratch of a build or of an output pass. Allocating moves a cursor through a
+ * large block (a new block is chained when one is full) and nothing is freed
+ * on its own; ArenaRelease rolls the cursor back to a mark taken earlier, and
+ * DestroyArena gives every block back at once. usedBytes is what is allocated
+ * now, peakBytes the most that ever was. An arena created with the exact
+ * ARENA_BYTES total of its allocations is a single block.
+ * An arena is not thread-safe: give each thread or object its own.
+ */
+struct Arena {
+    struct ArenaBlock* block;
+    size_t blockBytes;
+    size_t usedBytes;
+    size_t peakBytes;
+    size_t reservedBytes;
+};
+
+// Position of an arena's cursor (ArenaGetMark), to release what is allocated after it
+struct ArenaMark {
+    struct ArenaBlock* block;
+    size_t blockUsed;
+    size_t usedBytes;
+};
+
+// Public Methods:
+struct Arena* CreateArena(const size_t blockBytes);
+
+void* ArenaAllocate(struct Arena* arena, const size_t bytes);
+
+void* ArenaAllocateZeroed(struct Arena* arena, const size_t bytes);
+
+struct ArenaMark ArenaGetMark(const struct Arena* arena);
+
+void ArenaRelease(struct Arena* arena, const struct ArenaMark mark);
+
+void DestroyArena(struct Arena* arena);
+
+#endif
\ No newline at end of file
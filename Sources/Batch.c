@@ -0,0 +1,302 @@
+#include "Batch.h"
+#include "Search.h"
+#include "Output.h"
+#include <stdarg.h>
+#include <string.h>
+
+// Result slots per thread; bounds the results buffered for in-order output
+#define QUERIES_PER_THREAD 16
+
+struct TextBuffer {
+    size_t size;
+    size_t capacity;
+    char* text;
+};
+
+/**
+ * Per-thread scratch reused across queries, so a query allocates nothing:
+ * its own search state, priority queue (NULL for queue-free metrics) and a
+ * vertex buffer that GetPath fills with the path to the target.
+ */
+struct BatchWorker {
+    struct SearchState* state;
+    struct PriorityQueue* queue;
+    int* path;
+};
+
+/**
+ * Shared state of a batch. Threads claim queries in order from nextQuery, so
+ * no thread idles while any query is left. The result of a query is formatted
+ * into the ring slot results[queryIndex % numberOfSlots] once that slot is
+ * free, that is once queryIndex < nextToWrite + numberOfSlots, and written out
+ * by whichever thread completes the prefix that is next in line.
+ */
+struct Batch {
+    const struct Graph* graph;
+    const struct Metric* metric;
+    bool isLazy;
+    const struct QueryList* queryList;
+    struct BatchWorker* workers;
+    struct TextBuffer* results;
+    bool* isDone;
+    int numberOfSlots;
+    int nextQuery;
+    int nextToWrite;
+    pthread_mutex_t writeLock;
+    pthread_cond_t slotFreed;
+    FILE* file;
+};
+
+// Private Methods:
+static void AppendText(struct TextBuffer* buffer, const char* format, ...)
+{
+    while (true)
+    {
+        va_list arguments;
+        va_start(arguments, format);
+        const size_t available = buffer -> capacity - buffer -> size;
+        const int length = vsnprintf(buffer -> text + buffer -> size, available, format, arguments);
+        va_end(arguments);
+        if ((size_t) length < available)
+        {
+            buffer -> size += length;
+            return;
+        }
+        buffer -> capacity = 2 * buffer -> capacity + length + 1;
+        buffer -> text = (char*) realloc(buffer -> text, buffer -> capacity);
+    }
+}
+
+// Room for length more bytes at the end of the buffer
+static char* ReserveText(struct TextBuffer* buffer, const size_t length)
+{
+    if (buffer -> size + length > buffer -> capacity)
+    {
+        buffer -> capacity = 2 * buffer -> capacity + length;
+        buffer -> text = (char*) realloc(buffer -> text, buffer -> capacity);
+    }
+    return buffer -> text + buffer -> size;
+}
+
+static void AppendWeight(struct TextBuffer* buffer, const struct SearchState* state, const int index)
+{
+    char* text = ReserveText(buffer, WEIGHT_TEXT_SIZE + 1);
+    int length;
+    // Same convention as the fill files: -1 for unreachable or unsettled vertices
+    if (state -> weights[index] == state -> unreachableWeight || state -> heapIndices[index] != SETTLED)
+        length = FormatInteger(text, -1);
+    else
+        length = FormatWeight(text, state -> weights[index]);
+    text[length++] = '\n';
+    buffer -> size += length;
+}
+
+/**
+ * @brief Format the result of one query: a header line, then the weight and path of the
+ * target, or the weight of every vertex if the query has no target
+ * ! Complexity: O(V) or O(path length)
+ */
+static void FormatResult(struct TextBuffer* buffer, struct BatchWorker* worker, const int queryIndex, const struct Query* query, const int numberOfSettled)
+{
+    const struct SearchState* state = worker -> state;
+    buffer -> size = 0;
+    if (query -> targetId == -1)
+    {
+        AppendText(buffer, "Query %d: Source %d, Settled %d\n", queryIndex + 1, query -> sourceId, numberOfSettled);
+        for (int index = 0 ; index < state -> numberOfVertices ; index++)
+            AppendWeight(buffer, state, index);
+        return;
+    }
+    AppendText(buffer, "Query %d: Source %d, Target %d, Settled %d\n", queryIndex + 1, query -> sourceId, query -> targetId, numberOfSettled);
+    AppendWeight(buffer, state, query -> targetId - 1);
+    const int length = GetPath(state, query -> targetId, worker -> path);
+    for (int position = 0 ; position < length ; position++)
+    {
+        char* text = ReserveText(buffer, INTEGER_TEXT_SIZE + 4);
+        int size = FormatInteger(text, worker -> path[position]);
+        if (position < length - 1)
+        {
+            memcpy(text + size, " -> ", 4);
+            size += 4;
+        }
+        else
+            text[size++] = '\n';
+        buffer -> size += size;
+    }
+}
+
+static void RunQueryTask(struct Batch* batch, struct BatchWorker* worker, const int queryIndex)
+{
+    const struct Query* query = &batch -> queryList -> queries[queryIndex];
+    ResetSearchState(worker -> state, query -> sourceId); // ! O(touched vertices)
+    const int numberOfSettled = RunMetricQuery(batch -> metric, batch -> graph, worker -> state, worker -> queue, batch -> isLazy, query -> targetId);
+
+    // Wait for the slot of this query to be written out; the oldest query in flight never waits
+    const int slot = queryIndex % batch -> numberOfSlots;
+    pthread_mutex_lock(&batch -> writeLock);
+    while (queryIndex >= batch -> nextToWrite + batch -> numberOfSlots)
+        pthread_cond_wait(&batch -> slotFreed, &batch -> writeLock);
+    pthread_mutex_unlock(&batch -> writeLock);
+    FormatResult(&batch -> results[slot], worker, queryIndex, query, numberOfSettled);
+
+    // Write out every finished result that is next in line
+    pthread_mutex_lock(&batch -> writeLock);
+    batch -> isDone[slot] = true;
+    const int firstToWrite = batch -> nextToWrite;
+    while (batch -> isDone[batch -> nextToWrite % batch -> numberOfSlots])
+    {
+        const int nextSlot = batch -> nextToWrite % batch -> numberOfSlots;
+        const struct TextBuffer* result = &batch -> results[nextSlot];
+        fwrite(result -> text, 1, result -> size, batch -> file);
+        batch -> isDone[nextSlot] = false;
+        batch -> nextToWrite ++;
+    }
+    if (batch -> nextToWrite != firstToWrite)
+        pthread_cond_broadcast(&batch -> slotFreed);
+    pthread_mutex_unlock(&batch -> writeLock);
+}
+
+static void RunQueries(void* context, const int threadIndex, const int numberOfThreads)
+{
+    (void) numberOfThreads;
+    struct Batch* batch = (struct Batch*) context;
+    struct BatchWorker* worker = &batch -> workers[threadIndex];
+    while (true)
+    {
+        const int queryIndex = __atomic_fetch_add(&batch -> nextQuery, 1, __ATOMIC_RELAXED);
+        if (queryIndex >= batch -> queryList -> numberOfQueries)
+            return;
+        RunQueryTask(batch, worker, queryIndex);
+    }
+}
+
+// Public Methods:
+/**
+ * @brief Read a query file: one "source [target]" pair per line; blank lines and
+ * lines starting with % or # are skipped
+ * ! Complexity: O(file size)
+ * @param fileName 
+ * @return struct QueryList* 
+ */
+struct QueryList* ReadQueryFile(const char* fileName)
+{
+    FILE* file = fopen(fileName, "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open file %s\n", fileName);
+        exit(-1);
+    }
+    struct QueryList* queryList = (struct QueryList*) malloc(sizeof(struct QueryList));
+    queryList -> numberOfQueries = 0;
+    queryList -> capacity = 16;
+    queryList -> queries = (struct Query*) malloc(queryList -> capacity * sizeof(struct Query));
+    char line[256];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        lineNumber++;
+        int sourceId, targetId;
+        char first = '\0';
+        if (sscanf(line, " %c", &first) != 1 || first == '%' || first == '#')
+            continue;
+        // consumed ends after the last field read, so anything left but spaces is junk
+        int consumed = 0;
+        const int numberOfFields = sscanf(line, "%d%n %d%n", &sourceId, &consumed, &targetId, &consumed);
+        if (numberOfFields < 1 || line[consumed + strspn(line + consumed, " \t\r\n")] != '\0')
+        {
+            fprintf(stderr, "%s:%d: expected \"source [target]\"\n", fileName, lineNumber);
+            exit(-1);
+        }
+        if (queryList -> numberOfQueries == queryList -> capacity)
+        {
+            queryList -> capacity *= 2;
+            queryList -> queries = (struct Query*) realloc(queryList -> queries, queryList -> capacity * sizeof(struct Query));
+        }
+        queryList -> queries[queryList -> numberOfQueries].sourceId = sourceId;
+        queryList -> queries[queryList -> numberOfQueries].targetId = numberOfFields == 2 ? targetId : -1;
+        queryList -> numberOfQueries ++;
+    }
+    fclose(file);
+    return queryList;
+}
+
+/**
+ * @brief Deallocate and destroy a QueryList object
+ * ! Complexity: O(1)
+ * @param queryList 
+ */
+void DestroyQueryList(struct QueryList* queryList)
+{
+    free(queryList -> queries);
+    free(queryList);
+}
+
+/**
+ * @brief Answer every query of the list on one shared read-only graph, running them
+ * concurrently on the pool with threads claiming the next query as they finish one, and
+ * write the results to file in query order as soon as all earlier ones are written.
+ * At most QUERIES_PER_THREAD results per thread are buffered.
+ * ! Complexity: O(queries * (V + E)lgV / threads)
+ * @param graph 
+ * @param metric 
+ * @param queueBackend (NULL: the metric's queue-free search)
+ * @param isLazy 
+ * @param queryList 
+ * @param pool 
+ * @param file 
+ */
+void RunBatch(const struct Graph* graph, const struct Metric* metric, const struct QueueOperations* queueBackend, const bool isLazy, const struct QueryList* queryList, struct ThreadPool* pool, FILE* file)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    for (int queryIndex = 0 ; queryIndex < queryList -> numberOfQueries ; queryIndex++)
+    {
+        const struct Query* query = &queryList -> queries[queryIndex];
+        if (query -> sourceId < 1 || query -> sourceId > numberOfVertices || (query -> targetId != -1 && (query -> targetId < 1 || query -> targetId > numberOfVertices)))
+        {
+            fprintf(stderr, "Query %d: source and target vertices must be between 1 and %d\n", queryIndex + 1, numberOfVertices);
+            exit(-1);
+        }
+    }
+
+    const int numberOfThreads = pool -> numberOfThreads;
+    struct Batch batch;
+    batch.graph = graph;
+    batch.metric = metric;
+    batch.isLazy = isLazy;
+    batch.queryList = queryList;
+    batch.workers = (struct BatchWorker*) malloc(numberOfThreads * sizeof(struct BatchWorker));
+    for (int threadIndex = 0 ; threadIndex < numberOfThreads ; threadIndex++)
+    {
+        struct BatchWorker* worker = &batch.workers[threadIndex];
+        worker -> state = CreateSearchStateForMetric(metric, numberOfVertices);
+        worker -> queue = queueBackend != NULL ? CreatePriorityQueue(queueBackend, numberOfVertices) : NULL;
+        worker -> path = (int*) malloc(numberOfVertices * sizeof(int));
+    }
+    batch.numberOfSlots = QUERIES_PER_THREAD * numberOfThreads;
+    batch.results = (struct TextBuffer*) calloc(batch.numberOfSlots, sizeof(struct TextBuffer));
+    batch.isDone = (bool*) calloc(batch.numberOfSlots, sizeof(bool));
+    batch.nextQuery = 0;
+    batch.nextToWrite = 0;
+    pthread_mutex_init(&batch.writeLock, NULL);
+    pthread_cond_init(&batch.slotFreed, NULL);
+    batch.file = file;
+
+    RunInParallel(pool, RunQueries, &batch);
+    fflush(file);
+
+    pthread_cond_destroy(&batch.slotFreed);
+    pthread_mutex_destroy(&batch.writeLock);
+    for (int slot = 0 ; slot < batch.numberOfSlots ; slot++)
+        free(batch.results[slot].text);
+    free(batch.results);
+    free(batch.isDone);
+    for (int threadIndex = 0 ; threadIndex < numberOfThreads ; threadIndex++)
+    {
+        struct BatchWorker* worker = &batch.workers[threadIndex];
+        DestroySearchState(worker -> state);
+        if (worker -> queue != NULL)
+            DestroyPriorityQueue(worker -> queue);
+        free(worker -> path);
+    }
+    free(batch.workers);
+}
\ No newline at end of file
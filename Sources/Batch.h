@@ -0,0 +1,28 @@
+#ifndef __BATCH_H__
+#define __BATCH_H__
+#include "Graph.h"
+#include "Dijkstra.h"
+#include "PriorityQueue.h"
+#include "ThreadPool.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+struct Query {
+    int sourceId;
+    int targetId;   // -1: all vertices
+};
+
+struct QueryList {
+    int numberOfQueries;
+    int capacity;
+    struct Query* queries;
+};
+
+// Public Methods:
+struct QueryList* ReadQueryFile(const char* fileName);
+
+void DestroyQueryList(struct QueryList* queryList);
+
+void RunBatch(const struct Graph* graph, const struct Metric* metric, const struct QueueOperations* queueBackend, const bool isLazy, const struct QueryList* queryList, struct ThreadPool* pool, FILE* file);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,87 @@
+#!/bin/sh
+# Benchmark harness of the suite (make bench-suite): times A and B on every
+# queue backend and graph encoding over the given .mtx graphs and appends one
+# CSV row per configuration. Each configuration runs warmup times unmeasured,
+# then repetitions times with a -J report (see Instrument.h); the rows hold the
+# median and p99 (nearest rank) of the search phase and of the whole run.
+#
+# Usage: ./Benchmark.sh [-w warmup] [-r repetitions] [-o results.csv]
+#        [-b "A B"] [-q "queues"] [-e "encodings"] graph.mtx...
+# Encodings are csr (the CSR graph) and the -E ones (float32, uint16).
+
+warmup=2
+repetitions=20
+output=bench.csv
+binaries="A B"
+queues="binary dary4 dary8 pairing radix"
+encodings="csr float32 uint16"
+while getopts "w:r:o:b:q:e:" option
+do
+    case $option in
+        w) warmup=$OPTARG ;;
+        r) repetitions=$OPTARG ;;
+        o) output=$OPTARG ;;
+        b) binaries=$OPTARG ;;
+        q) queues=$OPTARG ;;
+        e) encodings=$OPTARG ;;
+        *) echo "Usage: $0 [-w warmup] [-r repetitions] [-o results.csv] [-b binaries] [-q queues] [-e encodings] graph.mtx..." >&2 ; exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+if [ $# -eq 0 ] || [ "$repetitions" -lt 1 ]
+then
+    echo "Usage: $0 [-w warmup] [-r repetitions] [-o results.csv] [-b binaries] [-q queues] [-e encodings] graph.mtx..." >&2
+    exit 1
+fi
+
+report=$(mktemp)
+samples=$(mktemp)
+trap 'rm -f "$report" "$samples" "$samples.search" "$samples.total"' EXIT
+
+# Print "median p99" of the numbers in a file, one per line
+summarize() {
+    sort -n "$1" | awk '{ value[NR] = $1 } END { p99 = int(NR * 0.99); if (p99 < NR * 0.99) p99++; printf "%.3f,%.3f", value[int((NR + 1) / 2)], value[p99] }'
+}
+
+# Print the value of a numeric field of the report
+field() {
+    sed -n "s/.*\"$1\": \([0-9.]*\).*/\1/p" "$report" | head -n 1
+}
+
+echo "graph,vertices,edges,binary,metric,queue,encoding,warmup,repetitions,search_median_ms,search_p99_ms,total_median_ms,total_p99_ms,peak_rss_mb" > "$output"
+for graph in "$@"
+do
+    for binary in $binaries
+    do
+        for queue in $queues
+        do
+            for encoding in $encodings
+            do
+                options="-z -o /dev/null -q $queue"
+                [ "$encoding" != csr ] && options="$options -E $encoding"
+                run=0
+                while [ $run -lt "$warmup" ]
+                do
+                    ./"$binary" $options "$graph" > /dev/null || exit 1
+                    run=$((run + 1))
+                done
+                : > "$samples"
+                peak=0
+                run=0
+                while [ $run -lt "$repetitions" ]
+                do
+                    ./"$binary" $options -J "$report" "$graph" > /dev/null || exit 1
+                    echo "$(sed -n 's/.*"name": "search", "ms": \([0-9.]*\).*/\1/p' "$report") $(field totalMs)" >> "$samples"
+                    rss=$(field peakResidentBytes)
+                    [ "$rss" -gt "$peak" ] && peak=$rss
+                    run=$((run + 1))
+                done
+                metric=$(sed -n 's/.*"metric": "\([a-z]*\)".*/\1/p' "$report")
+                cut -d ' ' -f 1 "$samples" > "$samples.search"
+                cut -d ' ' -f 2 "$samples" > "$samples.total"
+                echo "$graph,$(field vertices),$(field edges),$binary,$metric,$queue,$encoding,$warmup,$repetitions,$(summarize "$samples.search"),$(summarize "$samples.total"),$(awk "BEGIN { printf \"%.2f\", $peak / 1048576 }")" >> "$output"
+                echo "$graph $binary $queue $encoding done" >&2
+            done
+        done
+    done
+done
\ No newline at end of file
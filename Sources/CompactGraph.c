@@ -0,0 +1,287 @@
+#include "CompactGraph.h"
+#include "Arena.h"
+#include <stdlib.h>
+#include <math.h>
+
+// Codes a uint16 weight can take
+#define NUMBER_OF_CODES 65536
+// Block size of the scratch arena used while encoding
+#define SCRATCH_BLOCK_BYTES (1 << 16)
+
+struct CompactEdge {
+    int targetId;
+    double weight;
+};
+
+// Private Methods:
+static int CompareCompactEdges(const void* first, const void* second)
+{
+    const struct CompactEdge* firstEdge = (const struct CompactEdge*) first;
+    const struct CompactEdge* secondEdge = (const struct CompactEdge*) second;
+    if (firstEdge -> targetId != secondEdge -> targetId)
+        return firstEdge -> targetId < secondEdge -> targetId ? -1 : 1;
+    return (firstEdge -> weight > secondEdge -> weight) - (firstEdge -> weight < secondEdge -> weight);
+}
+
+static int CompareWeights(const void* first, const void* second)
+{
+    const double firstWeight = *(const double*) first;
+    const double secondWeight = *(const double*) second;
+    return (firstWeight > secondWeight) - (firstWeight < secondWeight);
+}
+
+/**
+ * @brief Copy the edges of a vertex into edges, sorted by target
+ * ! Complexity: O(deg lg deg)
+ * @return int the degree of the vertex
+ */
+static int SortVertexEdges(const struct Graph* graph, const int index, struct CompactEdge* edges)
+{
+    const int firstEdge = graph -> edgeOffsets[index];
+    const int degree = graph -> edgeOffsets[index + 1] - firstEdge;
+    for (int edge = 0 ; edge < degree ; edge++)
+    {
+        edges[edge].targetId = graph -> edgeTargets[firstEdge + edge];
+        edges[edge].weight = graph -> edgeWeights[firstEdge + edge];
+    }
+    qsort(edges, degree, sizeof(struct CompactEdge), CompareCompactEdges);
+    return degree;
+}
+
+// Target gap of the edge at position of a sorted edge list, as ReadCompactEdge decodes it
+static uint32_t GetTargetGap(const struct CompactEdge* edges, const int position, const int vertexId)
+{
+    if (position > 0)
+        return (uint32_t) (edges[position].targetId - edges[position - 1].targetId);
+    const int delta = edges[0].targetId - vertexId;
+    return ((uint32_t) delta << 1) ^ (uint32_t) (delta >> 31);
+}
+
+static int GetVarintLength(uint32_t value)
+{
+    int length = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        length++;
+    }
+    return length;
+}
+
+static unsigned char* WriteVarint(unsigned char* position, uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        *position++ = (unsigned char) (value | 0x80);
+        value >>= 7;
+    }
+    *position++ = (unsigned char) value;
+    return position;
+}
+
+/**
+ * @brief Collect the distinct weights of a graph into a sorted scratch array
+ * ! Complexity: O(E lgE)
+ * @return int the number of distinct weights
+ */
+static int GetDistinctWeights(const struct Graph* graph, struct Arena* scratch, double** weights)
+{
+    *weights = (double*) ArenaAllocate(scratch, (graph -> numberOfEdges > 0 ? graph -> numberOfEdges : 1) * sizeof(double));
+    memcpy(*weights, graph -> edgeWeights, graph -> numberOfEdges * sizeof(double));
+    qsort(*weights, graph -> numberOfEdges, sizeof(double), CompareWeights);
+    int numberOfWeights = 0;
+    for (int edge = 0 ; edge < graph -> numberOfEdges ; edge++)
+    {
+        if (numberOfWeights == 0 || (*weights)[edge] != (*weights)[numberOfWeights - 1])
+            (*weights)[numberOfWeights++] = (*weights)[edge];
+    }
+    return numberOfWeights;
+}
+
+/**
+ * @brief Code of a weight in the table of a uint16 graph: its position if the table holds
+ * every distinct weight, else the nearest of the evenly spaced levels
+ * ! Complexity: O(lg codes)
+ */
+static uint16_t EncodeWeight(const struct CompactGraph* graph, const bool isExact, const double weight)
+{
+    const double* table = graph -> weightTable;
+    if (!isExact)
+    {
+        const double step = (table[NUMBER_OF_CODES - 1] - table[0]) / (NUMBER_OF_CODES - 1);
+        const double level = step > 0.0 ? round((weight - table[0]) / step) : 0.0;
+        return (uint16_t) (level < 0.0 ? 0.0 : level > NUMBER_OF_CODES - 1 ? NUMBER_OF_CODES - 1 : level);
+    }
+    int low = 0, high = graph -> numberOfCodes - 1;
+    while (low < high)
+    {
+        const int middle = (low + high) / 2;
+        if (table[middle] < weight)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return (uint16_t) low;
+}
+
+// Public Methods:
+/**
+ * @brief Parse a weight encoding name: float32 or uint16
+ * ! Complexity: O(1)
+ * @param name 
+ * @param encoding 
+ * @return true if the name is known
+ */
+bool ParseWeightEncoding(const char* name, enum WeightEncoding* encoding)
+{
+    if (strcmp(name, "float32") == 0)
+        *encoding = WEIGHTS_FLOAT32;
+    else if (strcmp(name, "uint16") == 0)
+        *encoding = WEIGHTS_UINT16;
+    else
+        return false;
+    return true;
+}
+
+/**
+ * @brief Encode a Graph as a CompactGraph in two passes over its sorted edge lists: the
+ * first sizes the byte stream, the second writes it into an arena of exactly that size
+ * ! Complexity: O(V + E lg deg), O(E lgE) for uint16 weights
+ * @param graph 
+ * @param encoding 
+ * @return struct CompactGraph* 
+ */
+struct CompactGraph* CreateCompactGraph(const struct Graph* graph, const enum WeightEncoding encoding)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    const size_t weightBytes = encoding == WEIGHTS_FLOAT32 ? sizeof(float) : sizeof(uint16_t);
+    struct Arena* scratch = CreateArena(SCRATCH_BLOCK_BYTES);
+    int maximumDegree = 1;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        if (graph -> edgeOffsets[index + 1] - graph -> edgeOffsets[index] > maximumDegree)
+            maximumDegree = graph -> edgeOffsets[index + 1] - graph -> edgeOffsets[index];
+    }
+    struct CompactEdge* edges = (struct CompactEdge*) ArenaAllocate(scratch, maximumDegree * sizeof(struct CompactEdge));
+
+    // Pass 1: Size the stream of every vertex
+    size_t* byteOffsets = (size_t*) ArenaAllocate(scratch, (numberOfVertices + 1) * sizeof(size_t));
+    byteOffsets[0] = 0;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        const int degree = SortVertexEdges(graph, index, edges);
+        size_t numberOfBytes = degree * weightBytes;
+        for (int position = 0 ; position < degree ; position++)
+            numberOfBytes += GetVarintLength(GetTargetGap(edges, position, index + 1));
+        byteOffsets[index + 1] = byteOffsets[index] + numberOfBytes;
+    }
+    double* distinctWeights = NULL;
+    const int numberOfWeights = encoding == WEIGHTS_UINT16 ? GetDistinctWeights(graph, scratch, &distinctWeights) : 0;
+    const bool isExact = numberOfWeights <= NUMBER_OF_CODES;
+    const int numberOfCodes = encoding == WEIGHTS_FLOAT32 ? 0 : isExact ? numberOfWeights : NUMBER_OF_CODES;
+
+    struct CompactGraph* compactGraph = (struct CompactGraph*) malloc(sizeof(struct CompactGraph));
+    compactGraph -> numberOfVertices = numberOfVertices;
+    compactGraph -> numberOfEdges = graph -> numberOfEdges;
+    compactGraph -> encoding = encoding;
+    compactGraph -> numberOfCodes = numberOfCodes;
+    compactGraph -> maximumError = 0.0;
+    const size_t offsetBytes = (numberOfVertices + 1) * sizeof(size_t);
+    const size_t streamBytes = byteOffsets[numberOfVertices];
+    compactGraph -> arena = CreateArena(ARENA_BYTES(offsetBytes) + ARENA_BYTES(streamBytes) + (numberOfCodes > 0 ? ARENA_BYTES(numberOfCodes * sizeof(double)) : 0));
+    compactGraph -> byteOffsets = (size_t*) ArenaAllocate(compactGraph -> arena, offsetBytes);
+    memcpy(compactGraph -> byteOffsets, byteOffsets, offsetBytes);
+    compactGraph -> bytes = (unsigned char*) ArenaAllocate(compactGraph -> arena, streamBytes);
+    compactGraph -> weightTable = NULL;
+    if (numberOfCodes > 0)
+    {
+        compactGraph -> weightTable = (double*) ArenaAllocate(compactGraph -> arena, numberOfCodes * sizeof(double));
+        if (isExact)
+            memcpy(compactGraph -> weightTable, distinctWeights, numberOfCodes * sizeof(double));
+        else
+        {
+            const double minimum = distinctWeights[0], maximum = distinctWeights[numberOfWeights - 1];
+            for (int code = 0 ; code < NUMBER_OF_CODES ; code++)
+                compactGraph -> weightTable[code] = minimum + (maximum - minimum) * code / (NUMBER_OF_CODES - 1);
+            compactGraph -> weightTable[NUMBER_OF_CODES - 1] = maximum;
+        }
+    }
+
+    // Pass 2: Write the sorted edges
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        const int degree = SortVertexEdges(graph, index, edges);
+        unsigned char* position = compactGraph -> bytes + byteOffsets[index];
+        for (int edge = 0 ; edge < degree ; edge++)
+        {
+            position = WriteVarint(position, GetTargetGap(edges, edge, index + 1));
+            double storedWeight;
+            if (encoding == WEIGHTS_FLOAT32)
+            {
+                const float value = (float) edges[edge].weight;
+                memcpy(position, &value, sizeof(float));
+                storedWeight = value;
+            }
+            else
+            {
+                const uint16_t code = EncodeWeight(compactGraph, isExact, edges[edge].weight);
+                memcpy(position, &code, sizeof(uint16_t));
+                storedWeight = compactGraph -> weightTable[code];
+            }
+            position += weightBytes;
+            if (fabs(storedWeight - edges[edge].weight) > compactGraph -> maximumError)
+                compactGraph -> maximumError = fabs(storedWeight - edges[edge].weight);
+        }
+    }
+    DestroyArena(scratch);
+    return compactGraph;
+}
+
+/**
+ * @brief Bytes of the arrays of a CompactGraph: offsets, edge stream and weight table
+ * ! Complexity: O(1)
+ * @param graph 
+ * @return size_t 
+ */
+size_t GetCompactGraphBytes(const struct CompactGraph* graph)
+{
+    return (graph -> numberOfVertices + 1) * sizeof(size_t) + graph -> byteOffsets[graph -> numberOfVertices] + graph -> numberOfCodes * sizeof(double);
+}
+
+/**
+ * @brief Print a CompactGraph object like PrintGraph does, with its edges in stored order
+ * and decoded weights
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @param state 
+ */
+void PrintCompactGraph(const struct CompactGraph* graph, const struct SearchState* state)
+{
+    printf("\nGraph - Number of Vertices: %d\n", graph -> numberOfVertices);
+    for (int index = 0 ; index < graph -> numberOfVertices ; index++)
+    {
+        if (state != NULL)
+            printf("\nVertex %d, Weakness: %lf, Prev: %d, Heap Index: %d\n", index + 1, state -> weights[index], state -> previousVertexIds[index], state -> heapIndices[index]);
+        else
+            printf("\nVertex %d\n", index + 1);
+        const unsigned char* cursor = graph -> bytes + graph -> byteOffsets[index];
+        const unsigned char* end = graph -> bytes + graph -> byteOffsets[index + 1];
+        int neighbourId = index + 1;
+        for (bool isFirst = true ; cursor < end ; isFirst = false)
+        {
+            const double weight = ReadCompactEdge(graph, &cursor, &neighbourId, isFirst);
+            printf("%d -> %d Link Weakness: %lf\n", index + 1, neighbourId, weight);
+        }
+    }
+}
+
+/**
+ * @brief Deallocate and Destroy a CompactGraph Object
+ * ! Complexity: O(1)
+ * @param graph 
+ */
+void DestroyCompactGraph(struct CompactGraph* graph)
+{
+    DestroyArena(graph -> arena);
+    free(graph);
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#ifndef __COMPACTGRAPH_H__
+#define __COMPACTGRAPH_H__
+#include "Graph.h"
+#include "Search.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+struct Arena;
+
+// How the weight of every edge is stored
+enum WeightEncoding {
+    WEIGHTS_FLOAT32,    // 4 bytes, rounded to the nearest float
+    WEIGHTS_UINT16      // 2 bytes, a code into weightTable
+};
+
+/**
+ * Read-only graph with the edges of every vertex in a byte stream: sorted by
+ * target, each edge is a varint target gap followed by its weight. The first
+ * gap of a vertex is zigzag-encoded relative to the vertex itself, the others
+ * are unsigned gaps to the previous target (0 for a parallel edge).
+ * The edges of vertex v (1-based) are bytes[byteOffsets[v - 1] .. byteOffsets[v] - 1].
+ * uint16 weights are exact when the graph has at most 65536 distinct weights
+ * (weightTable holds them all); otherwise the table is 65536 evenly spaced
+ * levels between the smallest and the largest weight. maximumError is the
+ * largest difference between a stored and an original weight, 0 if exact.
+ * Everything lives in one arena.
+ */
+struct CompactGraph {
+    int numberOfVertices;
+    int numberOfEdges;
+    enum WeightEncoding encoding;
+    size_t* byteOffsets;
+    unsigned char* bytes;
+    double* weightTable;
+    int numberOfCodes;
+    double maximumError;
+    struct Arena* arena;
+};
+
+// Public Methods:
+bool ParseWeightEncoding(const char* name, enum WeightEncoding* encoding);
+
+struct CompactGraph* CreateCompactGraph(const struct Graph* graph, const enum WeightEncoding encoding);
+
+size_t GetCompactGraphBytes(const struct CompactGraph* graph);
+
+void PrintCompactGraph(const struct CompactGraph* graph, const struct SearchState* state);
+
+void DestroyCompactGraph(struct CompactGraph* graph);
+
+/**
+ * @brief Decode the next edge of a vertex's stream: advance *cursor past it, move
+ * *neighbourId to its target (isFirst: relative to the vertex) and return its weight
+ * ! Complexity: O(1)
+ */
+static inline double ReadCompactEdge(const struct CompactGraph* graph, const unsigned char** cursor, int* neighbourId, const bool isFirst)
+{
+    const unsigned char* position = *cursor;
+    uint32_t gap = *position++;
+    if (gap >= 0x80)
+    {
+        gap &= 0x7F;
+        int shift = 7;
+        uint32_t byte;
+        do
+        {
+            byte = *position++;
+            gap |= (byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte >= 0x80);
+    }
+    *neighbourId += isFirst ? (int) (gap >> 1) ^ -(int) (gap & 1) : (int) gap;
+    double weight;
+    if (graph -> encoding == WEIGHTS_FLOAT32)
+    {
+        float value;
+        memcpy(&value, position, sizeof(float));
+        position += sizeof(float);
+        weight = value;
+    }
+    else
+    {
+        uint16_t code;
+        memcpy(&code, position, sizeof(uint16_t));
+        position += sizeof(uint16_t);
+        weight = graph -> weightTable[code];
+    }
+    *cursor = position;
+    return weight;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,616 @@
+#include "ContractionHierarchy.h"
+#include "Semiring.h"
+#include "Snapshot.h"
+#include <string.h>
+
+/**
+ * Remaining graph during contraction: per-vertex growable lists of out- and
+ * in-edges between vertices that are not contracted yet. A contracted
+ * vertex's own lists are frozen and become its edges in the hierarchy.
+ */
+struct ContractionEdge {
+    int vertexId;
+    int middleId;       // -1 for an input edge
+    double weight;
+};
+
+struct ContractionList {
+    int size;
+    int capacity;
+    struct ContractionEdge* edges;
+};
+
+struct Shortcut {
+    int sourceId;
+    int targetId;
+    double weight;
+};
+
+struct ShortcutList {
+    int size;
+    int capacity;
+    struct Shortcut* shortcuts;
+};
+
+/**
+ * Preprocessing state. Per-thread scratch (search state, queue and target
+ * marks for the witness searches) is indexed by thread; selectedIds/shortcutLists hold the
+ * independent set of the current round, dirtyIds the vertices whose
+ * priority has to be recomputed.
+ */
+struct Contraction {
+    int numberOfVertices;
+    struct ContractionList* outLists;
+    struct ContractionList* inLists;
+    int* ranks;                     // -1 while not contracted
+    int* priorities;
+    int* contractedNeighbourCounts;
+    bool* isContracting;
+    int numberOfSelected;
+    int* selectedIds;
+    struct ShortcutList* shortcutLists;
+    int numberOfDirty;
+    int* dirtyIds;
+    bool* isDirty;
+    int numberOfThreads;
+    struct SearchState** states;
+    struct PriorityQueue** queues;
+    int** targetMarks;              // targetMarks[thread][w - 1] == v: w is an out-neighbour of v
+};
+
+struct HierarchyOperations {
+    const char* name;
+    struct ContractionHierarchy* (*Contract)(const struct Graph* graph, const struct Metric* metric, struct ThreadPool* pool);
+    void (*Query)(const struct ContractionHierarchy* hierarchy, struct SearchState* forward, struct SearchState* backward, struct PriorityQueue* forwardQueue, struct PriorityQueue* backwardQueue, struct BidirectionalResult* result);
+};
+
+// Private Methods:
+static inline uint64_t AlignToWord(const uint64_t position)
+{
+    return (position + 7) / 8 * 8;
+}
+
+static void AppendContractionEdge(struct ContractionList* list, const int vertexId, const int middleId, const double weight)
+{
+    if (list -> size == list -> capacity)
+    {
+        list -> capacity = list -> capacity > 0 ? 2 * list -> capacity : 4;
+        list -> edges = (struct ContractionEdge*) realloc(list -> edges, list -> capacity * sizeof(struct ContractionEdge));
+    }
+    list -> edges[list -> size].vertexId = vertexId;
+    list -> edges[list -> size].middleId = middleId;
+    list -> edges[list -> size].weight = weight;
+    list -> size ++;
+}
+
+static void RemoveContractionEdge(struct ContractionList* list, const int vertexId)
+{
+    for (int index = 0 ; index < list -> size ; index++)
+    {
+        if (list -> edges[index].vertexId == vertexId)
+        {
+            list -> edges[index] = list -> edges[-- list -> size];
+            return;
+        }
+    }
+}
+
+static void AppendShortcut(struct ShortcutList* list, const int sourceId, const int targetId, const double weight)
+{
+    if (list -> size == list -> capacity)
+    {
+        list -> capacity = list -> capacity > 0 ? 2 * list -> capacity : 16;
+        list -> shortcuts = (struct Shortcut*) realloc(list -> shortcuts, list -> capacity * sizeof(struct Shortcut));
+    }
+    list -> shortcuts[list -> size].sourceId = sourceId;
+    list -> shortcuts[list -> size].targetId = targetId;
+    list -> shortcuts[list -> size].weight = weight;
+    list -> size ++;
+}
+
+static struct Contraction* CreateContraction(const int numberOfVertices, const struct Metric* metric, struct ThreadPool* pool)
+{
+    struct Contraction* contraction = (struct Contraction*) malloc(sizeof(struct Contraction));
+    contraction -> numberOfVertices = numberOfVertices;
+    contraction -> outLists = (struct ContractionList*) calloc(numberOfVertices, sizeof(struct ContractionList));
+    contraction -> inLists = (struct ContractionList*) calloc(numberOfVertices, sizeof(struct ContractionList));
+    contraction -> ranks = (int*) malloc(numberOfVertices * sizeof(int));
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        contraction -> ranks[index] = -1;
+    contraction -> priorities = (int*) calloc(numberOfVertices, sizeof(int));
+    contraction -> contractedNeighbourCounts = (int*) calloc(numberOfVertices, sizeof(int));
+    contraction -> isContracting = (bool*) calloc(numberOfVertices, sizeof(bool));
+    contraction -> numberOfSelected = 0;
+    contraction -> selectedIds = (int*) malloc(numberOfVertices * sizeof(int));
+    contraction -> shortcutLists = (struct ShortcutList*) calloc(numberOfVertices, sizeof(struct ShortcutList));
+    contraction -> numberOfDirty = 0;
+    contraction -> dirtyIds = (int*) malloc(numberOfVertices * sizeof(int));
+    contraction -> isDirty = (bool*) calloc(numberOfVertices, sizeof(bool));
+    contraction -> numberOfThreads = pool -> numberOfThreads;
+    contraction -> states = (struct SearchState**) malloc(pool -> numberOfThreads * sizeof(struct SearchState*));
+    contraction -> queues = (struct PriorityQueue**) malloc(pool -> numberOfThreads * sizeof(struct PriorityQueue*));
+    contraction -> targetMarks = (int**) malloc(pool -> numberOfThreads * sizeof(int*));
+    for (int thread = 0 ; thread < pool -> numberOfThreads ; thread++)
+    {
+        contraction -> states[thread] = CreateSearchStateForMetric(metric, numberOfVertices);
+        contraction -> queues[thread] = CreatePriorityQueue(&BinaryHeapOperations, numberOfVertices);
+        contraction -> targetMarks[thread] = (int*) calloc(numberOfVertices, sizeof(int));
+    }
+    return contraction;
+}
+
+static void DestroyContraction(struct Contraction* contraction)
+{
+    for (int index = 0 ; index < contraction -> numberOfVertices ; index++)
+    {
+        free(contraction -> outLists[index].edges);
+        free(contraction -> inLists[index].edges);
+        free(contraction -> shortcutLists[index].shortcuts);
+    }
+    for (int thread = 0 ; thread < contraction -> numberOfThreads ; thread++)
+    {
+        DestroySearchState(contraction -> states[thread]);
+        DestroyPriorityQueue(contraction -> queues[thread]);
+        free(contraction -> targetMarks[thread]);
+    }
+    free(contraction -> outLists);
+    free(contraction -> inLists);
+    free(contraction -> ranks);
+    free(contraction -> priorities);
+    free(contraction -> contractedNeighbourCounts);
+    free(contraction -> isContracting);
+    free(contraction -> selectedIds);
+    free(contraction -> shortcutLists);
+    free(contraction -> dirtyIds);
+    free(contraction -> isDirty);
+    free(contraction -> states);
+    free(contraction -> queues);
+    free(contraction -> targetMarks);
+    free(contraction);
+}
+
+static void MarkContractionDirty(struct Contraction* contraction, const int vertexId)
+{
+    if (contraction -> isDirty[vertexId - 1])
+        return;
+    contraction -> isDirty[vertexId - 1] = true;
+    contraction -> dirtyIds[contraction -> numberOfDirty ++] = vertexId;
+}
+
+static void ClearContractionDirty(struct Contraction* contraction)
+{
+    for (int index = 0 ; index < contraction -> numberOfDirty ; index++)
+        contraction -> isDirty[contraction -> dirtyIds[index] - 1] = false;
+    contraction -> numberOfDirty = 0;
+}
+
+static inline bool IsContractedBefore(const struct Contraction* contraction, const int vertexId, const int otherVertexId)
+{
+    const int priority = contraction -> priorities[vertexId - 1], otherPriority = contraction -> priorities[otherVertexId - 1];
+    return priority < otherPriority || (priority == otherPriority && vertexId < otherVertexId);
+}
+
+static bool IsLocalMinimum(const struct Contraction* contraction, const int vertexId)
+{
+    const struct ContractionList* outList = &contraction -> outLists[vertexId - 1];
+    const struct ContractionList* inList = &contraction -> inLists[vertexId - 1];
+    for (int index = 0 ; index < outList -> size ; index++)
+    {
+        if (!IsContractedBefore(contraction, vertexId, outList -> edges[index].vertexId))
+            return false;
+    }
+    for (int index = 0 ; index < inList -> size ; index++)
+    {
+        if (!IsContractedBefore(contraction, vertexId, inList -> edges[index].vertexId))
+            return false;
+    }
+    return true;
+}
+
+static void SelectTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    struct Contraction* contraction = (struct Contraction*) context;
+    const int numberOfVertices = contraction -> numberOfVertices;
+    const int first = (int) ((long) numberOfVertices * threadIndex / numberOfThreads);
+    const int last = (int) ((long) numberOfVertices * (threadIndex + 1) / numberOfThreads);
+    for (int index = first ; index < last ; index++)
+        contraction -> isContracting[index] = contraction -> ranks[index] == -1 && IsLocalMinimum(contraction, index + 1);
+}
+
+/**
+ * @brief Select the remaining vertices whose priority is lower than every remaining
+ * neighbour's (ties broken by id). No two of them are adjacent, and the vertex with the
+ * lowest priority always qualifies, so every round makes progress.
+ * ! Complexity: O(V + E) / threads
+ * @param contraction 
+ * @param pool 
+ */
+static void SelectIndependentSet(struct Contraction* contraction, struct ThreadPool* pool)
+{
+    RunInParallel(pool, SelectTask, contraction);
+    contraction -> numberOfSelected = 0;
+    for (int index = 0 ; index < contraction -> numberOfVertices ; index++)
+    {
+        if (contraction -> isContracting[index])
+            contraction -> selectedIds[contraction -> numberOfSelected ++] = index + 1;
+    }
+}
+
+/**
+ * @brief Take a contracted vertex out of its neighbours' lists; its own lists stay as they
+ * are, holding exactly its edges to higher-ranked vertices
+ * ! Complexity: O(deg^2)
+ * @param contraction 
+ * @param vertexId 
+ */
+static void RemoveContractedVertex(struct Contraction* contraction, const int vertexId)
+{
+    const struct ContractionList* outList = &contraction -> outLists[vertexId - 1];
+    const struct ContractionList* inList = &contraction -> inLists[vertexId - 1];
+    for (int index = 0 ; index < outList -> size ; index++)
+    {
+        const int neighbourId = outList -> edges[index].vertexId;
+        RemoveContractionEdge(&contraction -> inLists[neighbourId - 1], vertexId);
+        contraction -> contractedNeighbourCounts[neighbourId - 1] ++;
+        MarkContractionDirty(contraction, neighbourId);
+    }
+    for (int index = 0 ; index < inList -> size ; index++)
+    {
+        const int neighbourId = inList -> edges[index].vertexId;
+        RemoveContractionEdge(&contraction -> outLists[neighbourId - 1], vertexId);
+        contraction -> contractedNeighbourCounts[neighbourId - 1] ++;
+        MarkContractionDirty(contraction, neighbourId);
+    }
+}
+
+static struct Graph* CreateSearchGraph(const int numberOfVertices, const int numberOfEdges)
+{
+    struct Graph* graph = (struct Graph*) malloc(sizeof(struct Graph));
+    graph -> numberOfVertices = numberOfVertices;
+    graph -> numberOfEdges = numberOfEdges;
+    graph -> mapping = NULL;
+    graph -> mappingBytes = 0;
+    AllocateGraphArrays(graph);
+    return graph;
+}
+
+/**
+ * @brief Turn the frozen per-vertex lists into the CSR upward and downward search graphs
+ * ! Complexity: O(V + E + shortcuts)
+ * @param lists outLists for the upward graph, inLists for the downward one
+ * @param numberOfVertices 
+ * @param middleIds (output)
+ * @return struct Graph* 
+ */
+static struct Graph* CreateGraphFromLists(const struct ContractionList* lists, const int numberOfVertices, int** middleIds)
+{
+    int numberOfEdges = 0;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        numberOfEdges += lists[index].size;
+    struct Graph* graph = CreateSearchGraph(numberOfVertices, numberOfEdges);
+    *middleIds = (int*) malloc((numberOfEdges > 0 ? numberOfEdges : 1) * sizeof(int));
+    int edge = 0;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        graph -> edgeOffsets[index] = edge;
+        for (int position = 0 ; position < lists[index].size ; position++, edge++)
+        {
+            graph -> edgeTargets[edge] = lists[index].edges[position].vertexId;
+            graph -> edgeWeights[edge] = lists[index].edges[position].weight;
+            (*middleIds)[edge] = lists[index].edges[position].middleId;
+        }
+    }
+    graph -> edgeOffsets[numberOfVertices] = edge;
+    return graph;
+}
+
+static int CountShortcuts(const int* middleIds, const int numberOfEdges)
+{
+    int numberOfShortcuts = 0;
+    for (int edge = 0 ; edge < numberOfEdges ; edge++)
+        numberOfShortcuts += middleIds[edge] != -1;
+    return numberOfShortcuts;
+}
+
+static struct ContractionHierarchy* CreateHierarchyFromContraction(struct Contraction* contraction)
+{
+    const int numberOfVertices = contraction -> numberOfVertices;
+    struct ContractionHierarchy* hierarchy = (struct ContractionHierarchy*) malloc(sizeof(struct ContractionHierarchy));
+    hierarchy -> numberOfVertices = numberOfVertices;
+    hierarchy -> ranks = contraction -> ranks;
+    contraction -> ranks = NULL;
+    hierarchy -> upwardGraph = CreateGraphFromLists(contraction -> outLists, numberOfVertices, &hierarchy -> upwardMiddleIds);
+    hierarchy -> downwardGraph = CreateGraphFromLists(contraction -> inLists, numberOfVertices, &hierarchy -> downwardMiddleIds);
+    hierarchy -> numberOfShortcuts = CountShortcuts(hierarchy -> upwardMiddleIds, hierarchy -> upwardGraph -> numberOfEdges)
+        + CountShortcuts(hierarchy -> downwardMiddleIds, hierarchy -> downwardGraph -> numberOfEdges);
+    return hierarchy;
+}
+
+/**
+ * @brief Find the hierarchy edge sourceId -> targetId: among the upward edges of sourceId
+ * if targetId ranks higher, among the downward edges of targetId otherwise
+ * ! Complexity: O(deg)
+ * @param hierarchy 
+ * @param sourceId 
+ * @param targetId 
+ * @param middleId (output) vertex the edge bypasses, -1 for an input edge
+ * @return double weight of the edge
+ */
+static double FindHierarchyEdge(const struct ContractionHierarchy* hierarchy, const int sourceId, const int targetId, int* middleId)
+{
+    const bool isUpward = hierarchy -> ranks[sourceId - 1] < hierarchy -> ranks[targetId - 1];
+    const struct Graph* graph = isUpward ? hierarchy -> upwardGraph : hierarchy -> downwardGraph;
+    const int* middleIds = isUpward ? hierarchy -> upwardMiddleIds : hierarchy -> downwardMiddleIds;
+    const int vertexId = isUpward ? sourceId : targetId, neighbourId = isUpward ? targetId : sourceId;
+    for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < graph -> edgeOffsets[vertexId] ; edge++)
+    {
+        if (graph -> edgeTargets[edge] == neighbourId)
+        {
+            *middleId = middleIds[edge];
+            return graph -> edgeWeights[edge];
+        }
+    }
+    fprintf(stderr, "Hierarchy has no edge %d -> %d\n", sourceId, targetId);
+    exit(-1);
+}
+
+#define SEMIRING Additive
+#include "ContractionTemplate.h"
+
+#define SEMIRING Reliability
+#include "ContractionTemplate.h"
+
+#define SEMIRING Widest
+#include "ContractionTemplate.h"
+
+#define SEMIRING Hops
+#include "ContractionTemplate.h"
+
+static const struct HierarchyOperations HIERARCHY_OPERATIONS[] = {
+    {"additive", ContractHierarchyAdditive, QueryHierarchyAdditive},
+    {"reliability", ContractHierarchyReliability, QueryHierarchyReliability},
+    {"widest", ContractHierarchyWidest, QueryHierarchyWidest},
+    {"hops", ContractHierarchyHops, QueryHierarchyHops}
+};
+
+static const struct HierarchyOperations* FindHierarchyOperations(const struct Metric* metric)
+{
+    for (int index = 0 ; index < (int) (sizeof(HIERARCHY_OPERATIONS) / sizeof(HIERARCHY_OPERATIONS[0])) ; index++)
+    {
+        if (strcmp(HIERARCHY_OPERATIONS[index].name, metric -> name) == 0)
+            return &HIERARCHY_OPERATIONS[index];
+    }
+    fprintf(stderr, "Metric %s has no contraction hierarchy\n", metric -> name);
+    exit(-1);
+}
+
+static void AppendUnpackedEdge(const struct ContractionHierarchy* hierarchy, const int sourceId, const int targetId, int* path, int* length)
+{
+    int middleId;
+    FindHierarchyEdge(hierarchy, sourceId, targetId, &middleId);
+    if (middleId == -1)
+    {
+        path[(*length) ++] = targetId;
+        return;
+    }
+    AppendUnpackedEdge(hierarchy, sourceId, middleId, path, length);
+    AppendUnpackedEdge(hierarchy, middleId, targetId, path, length);
+}
+
+static void AppendForwardPath(const struct ContractionHierarchy* hierarchy, const struct SearchState* forward, const int vertexId, int* path, int* length)
+{
+    const int previousVertexId = forward -> previousVertexIds[vertexId - 1];
+    if (previousVertexId == -1)
+    {
+        path[(*length) ++] = vertexId;
+        return;
+    }
+    AppendForwardPath(hierarchy, forward, previousVertexId, path, length);
+    AppendUnpackedEdge(hierarchy, previousVertexId, vertexId, path, length);
+}
+
+static unsigned char* AppendSection(unsigned char* cursor, const void* data, const uint64_t numberOfBytes)
+{
+    memcpy(cursor, data, numberOfBytes);
+    return cursor + AlignToWord(numberOfBytes);
+}
+
+static const unsigned char* ReadSection(const unsigned char* cursor, void* data, const uint64_t numberOfBytes)
+{
+    memcpy(data, cursor, numberOfBytes);
+    return cursor + AlignToWord(numberOfBytes);
+}
+
+static uint64_t GetSearchGraphBytes(const uint64_t numberOfVertices, const uint64_t numberOfEdges)
+{
+    return AlignToWord((numberOfVertices + 1) * sizeof(int)) + 2 * AlignToWord(numberOfEdges * sizeof(int)) + numberOfEdges * sizeof(double);
+}
+
+static unsigned char* AppendSearchGraph(unsigned char* cursor, const struct Graph* graph, const int* middleIds)
+{
+    cursor = AppendSection(cursor, graph -> edgeOffsets, (graph -> numberOfVertices + 1) * sizeof(int));
+    cursor = AppendSection(cursor, graph -> edgeTargets, graph -> numberOfEdges * sizeof(int));
+    cursor = AppendSection(cursor, middleIds, graph -> numberOfEdges * sizeof(int));
+    return AppendSection(cursor, graph -> edgeWeights, graph -> numberOfEdges * sizeof(double));
+}
+
+static const unsigned char* ReadSearchGraph(const unsigned char* cursor, const int numberOfVertices, const int numberOfEdges, struct Graph** graph, int** middleIds)
+{
+    *graph = CreateSearchGraph(numberOfVertices, numberOfEdges);
+    *middleIds = (int*) malloc((numberOfEdges > 0 ? numberOfEdges : 1) * sizeof(int));
+    cursor = ReadSection(cursor, (*graph) -> edgeOffsets, (numberOfVertices + 1) * sizeof(int));
+    cursor = ReadSection(cursor, (*graph) -> edgeTargets, numberOfEdges * sizeof(int));
+    cursor = ReadSection(cursor, *middleIds, numberOfEdges * sizeof(int));
+    return ReadSection(cursor, (*graph) -> edgeWeights, numberOfEdges * sizeof(double));
+}
+
+static struct ContractionHierarchy* RejectHierarchy(const char* fileName, const char* reason, FILE* file, void* payload)
+{
+    fprintf(stderr, "Hierarchy %s: %s, recomputing\n", fileName, reason);
+    fclose(file);
+    free(payload);
+    return NULL;
+}
+
+// Public Methods:
+/**
+ * @brief Contract every vertex of the graph (see ContractHierarchy<S> in ContractionTemplate.h)
+ * ! Complexity: O(V * in-degree * witness search) in practice, divided over the threads
+ * @param graph 
+ * @param metric 
+ * @param pool 
+ * @return struct ContractionHierarchy* 
+ */
+struct ContractionHierarchy* BuildContractionHierarchy(const struct Graph* graph, const struct Metric* metric, struct ThreadPool* pool)
+{
+    return FindHierarchyOperations(metric) -> Contract(graph, metric, pool);
+}
+
+/**
+ * @brief Answer a point-to-point query on a hierarchy between the sources of two freshly
+ * reset search states (forward: the source, backward: the target)
+ * ! Complexity: O(search space lg(search space))
+ * @param hierarchy 
+ * @param metric 
+ * @param forward 
+ * @param backward 
+ * @param forwardQueue 
+ * @param backwardQueue 
+ * @param result 
+ */
+void QueryContractionHierarchy(const struct ContractionHierarchy* hierarchy, const struct Metric* metric, struct SearchState* forward, struct SearchState* backward, struct PriorityQueue* forwardQueue, struct PriorityQueue* backwardQueue, struct BidirectionalResult* result)
+{
+    FindHierarchyOperations(metric) -> Query(hierarchy, forward, backward, forwardQueue, backwardQueue, result);
+}
+
+/**
+ * @brief Write the path found by a hierarchy query, from source to target, into path
+ * (room for V vertices) with every shortcut unpacked into the input edges it stands for
+ * ! Complexity: O(path length * deg)
+ * @param hierarchy 
+ * @param forward 
+ * @param backward 
+ * @param meetingVertexId 
+ * @param path 
+ * @return int number of vertices on the path (0 if there is none)
+ */
+int GetHierarchyPath(const struct ContractionHierarchy* hierarchy, const struct SearchState* forward, const struct SearchState* backward, const int meetingVertexId, int* path)
+{
+    if (meetingVertexId == -1)
+        return 0;
+    int length = 0;
+    AppendForwardPath(hierarchy, forward, meetingVertexId, path, &length);
+    for (int vertexId = meetingVertexId ; backward -> previousVertexIds[vertexId - 1] != -1 ; vertexId = backward -> previousVertexIds[vertexId - 1])
+        AppendUnpackedEdge(hierarchy, vertexId, backward -> previousVertexIds[vertexId - 1], path, &length);
+    return length;
+}
+
+/**
+ * @brief Write a hierarchy to a sidecar file (via a temporary file and a rename).
+ * As with the landmark file, a failure is returned rather than fatal.
+ * ! Complexity: O(V + E + shortcuts)
+ * @param hierarchy 
+ * @param graph 
+ * @param metric 
+ * @param fileName 
+ * @return true if the file was written
+ */
+bool WriteContractionHierarchy(const struct ContractionHierarchy* hierarchy, const struct Graph* graph, const struct Metric* metric, const char* fileName)
+{
+    struct HierarchyHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, HIERARCHY_MAGIC, sizeof(HIERARCHY_MAGIC));
+    header.version = HIERARCHY_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    strncpy(header.metricName, metric -> name, sizeof(header.metricName) - 1);
+    header.numberOfVertices = graph -> numberOfVertices;
+    header.numberOfEdges = graph -> numberOfEdges;
+    header.graphFingerprint = ComputeGraphFingerprint(graph);
+    header.numberOfUpwardEdges = hierarchy -> upwardGraph -> numberOfEdges;
+    header.numberOfDownwardEdges = hierarchy -> downwardGraph -> numberOfEdges;
+    header.numberOfShortcuts = hierarchy -> numberOfShortcuts;
+
+    const uint64_t payloadBytes = AlignToWord(header.numberOfVertices * sizeof(int))
+        + GetSearchGraphBytes(header.numberOfVertices, header.numberOfUpwardEdges) + GetSearchGraphBytes(header.numberOfVertices, header.numberOfDownwardEdges);
+    unsigned char* payload = (unsigned char*) calloc(payloadBytes, 1);
+    unsigned char* cursor = AppendSection(payload, hierarchy -> ranks, header.numberOfVertices * sizeof(int));
+    cursor = AppendSearchGraph(cursor, hierarchy -> upwardGraph, hierarchy -> upwardMiddleIds);
+    AppendSearchGraph(cursor, hierarchy -> downwardGraph, hierarchy -> downwardMiddleIds);
+    header.checksum = ComputeChecksum(payload, payloadBytes);
+
+    char* temporaryName = (char*) malloc(strlen(fileName) + 5);
+    sprintf(temporaryName, "%s.tmp", fileName);
+    FILE* file = fopen(temporaryName, "wb");
+    bool isWritten = false;
+    if (file != NULL)
+    {
+        isWritten = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(payload, payloadBytes, 1, file) == 1;
+        isWritten = fclose(file) == 0 && isWritten && rename(temporaryName, fileName) == 0;
+        if (!isWritten)
+            remove(temporaryName);
+    }
+    free(temporaryName);
+    free(payload);
+    return isWritten;
+}
+
+/**
+ * @brief Load a hierarchy from a sidecar file. Like the landmark file it is only a cache:
+ * NULL is returned if it is missing, damaged, or was built for another graph or metric.
+ * ! Complexity: O(V + E + shortcuts)
+ * @param fileName 
+ * @param graph 
+ * @param metric 
+ * @return struct ContractionHierarchy* (NULL if the file cannot be used)
+ */
+struct ContractionHierarchy* LoadContractionHierarchy(const char* fileName, const struct Graph* graph, const struct Metric* metric)
+{
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL)
+        return NULL;
+    struct HierarchyHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, HIERARCHY_MAGIC, sizeof(HIERARCHY_MAGIC)) != 0)
+        return RejectHierarchy(fileName, "Not a hierarchy file", file, NULL);
+    if (header.version != HIERARCHY_VERSION || header.byteOrder != SNAPSHOT_BYTE_ORDER)
+        return RejectHierarchy(fileName, "Unsupported version or byte order", file, NULL);
+    if (strncmp(header.metricName, metric -> name, sizeof(header.metricName)) != 0)
+        return RejectHierarchy(fileName, "Built for another metric", file, NULL);
+    if (header.numberOfVertices != (uint64_t) graph -> numberOfVertices || header.numberOfEdges != (uint64_t) graph -> numberOfEdges
+        || header.graphFingerprint != ComputeGraphFingerprint(graph))
+        return RejectHierarchy(fileName, "Built for another graph", file, NULL);
+    if (header.numberOfUpwardEdges >= INT_MAX || header.numberOfDownwardEdges >= INT_MAX)
+        return RejectHierarchy(fileName, "Corrupt header", file, NULL);
+
+    const uint64_t payloadBytes = AlignToWord(header.numberOfVertices * sizeof(int))
+        + GetSearchGraphBytes(header.numberOfVertices, header.numberOfUpwardEdges) + GetSearchGraphBytes(header.numberOfVertices, header.numberOfDownwardEdges);
+    unsigned char* payload = (unsigned char*) malloc(payloadBytes);
+    if (fread(payload, payloadBytes, 1, file) != 1 || ComputeChecksum(payload, payloadBytes) != header.checksum)
+        return RejectHierarchy(fileName, "Checksum mismatch", file, payload);
+    fclose(file);
+
+    const int numberOfVertices = graph -> numberOfVertices;
+    struct ContractionHierarchy* hierarchy = (struct ContractionHierarchy*) malloc(sizeof(struct ContractionHierarchy));
+    hierarchy -> numberOfVertices = numberOfVertices;
+    hierarchy -> numberOfShortcuts = (int) header.numberOfShortcuts;
+    hierarchy -> ranks = (int*) malloc(numberOfVertices * sizeof(int));
+    const unsigned char* cursor = ReadSection(payload, hierarchy -> ranks, numberOfVertices * sizeof(int));
+    cursor = ReadSearchGraph(cursor, numberOfVertices, (int) header.numberOfUpwardEdges, &hierarchy -> upwardGraph, &hierarchy -> upwardMiddleIds);
+    ReadSearchGraph(cursor, numberOfVertices, (int) header.numberOfDownwardEdges, &hierarchy -> downwardGraph, &hierarchy -> downwardMiddleIds);
+    free(payload);
+    return hierarchy;
+}
+
+/**
+ * @brief Destroy a ContractionHierarchy object
+ * ! Complexity: O(1)
+ * @param hierarchy 
+ */
+void DestroyContractionHierarchy(struct ContractionHierarchy* hierarchy)
+{
+    free(hierarchy -> ranks);
+    DestroyGraph(hierarchy -> upwardGraph);
+    DestroyGraph(hierarchy -> downwardGraph);
+    free(hierarchy -> upwardMiddleIds);
+    free(hierarchy -> downwardMiddleIds);
+    free(hierarchy);
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef __CONTRACTIONHIERARCHY_H__
+#define __CONTRACTIONHIERARCHY_H__
+#include "Dijkstra.h"
+#include "Graph.h"
+#include "ThreadPool.h"
+#include <stdint.h>
+
+#define HIERARCHY_MAGIC "DIJKCH"
+#define HIERARCHY_VERSION 1
+#define HIERARCHY_METRIC_NAME_BYTES 16
+// Witness searches give up after settling this many vertices and keep the shortcut
+#define WITNESS_SETTLE_LIMIT 256
+// The same limit when only estimating a vertex's priority
+#define WITNESS_ESTIMATE_SETTLE_LIMIT 8
+
+/**
+ * Contraction hierarchy: every vertex has a rank (its contraction order) and
+ * every edge of the search graphs leads from a vertex to a higher-ranked one.
+ * upwardGraph holds the out-edges u -> x of u, downwardGraph the in-edges
+ * x -> u of u stored as u -> x, so a query searches upwardGraph forward from
+ * the source and downwardGraph forward from the target. Edge weights are in
+ * the metric's space (a path's weight is the Join of its edges' weights).
+ * A shortcut records the vertex it bypasses in the middle-id arrays, -1 for
+ * an edge of the input graph, which is what path unpacking follows.
+ */
+struct ContractionHierarchy {
+    int numberOfVertices;
+    int numberOfShortcuts;
+    int* ranks;
+    struct Graph* upwardGraph;
+    struct Graph* downwardGraph;
+    int* upwardMiddleIds;
+    int* downwardMiddleIds;
+};
+
+/**
+ * On-disk layout of a hierarchy sidecar file: this header, then ranks, the
+ * upward graph (offsets, targets, middle ids, weights) and the downward graph
+ * in the same order, each array padded to 8 bytes. Like the landmark file it
+ * is tied to one graph and metric; the checksum covers every byte after the header.
+ */
+struct HierarchyHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    char metricName[HIERARCHY_METRIC_NAME_BYTES];
+    uint64_t numberOfVertices;
+    uint64_t numberOfEdges;
+    uint64_t graphFingerprint;
+    uint64_t numberOfUpwardEdges;
+    uint64_t numberOfDownwardEdges;
+    uint64_t numberOfShortcuts;
+    uint64_t checksum;
+};
+
+// Public Methods:
+struct ContractionHierarchy* BuildContractionHierarchy(const struct Graph* graph, const struct Metric* metric, struct ThreadPool* pool);
+
+void QueryContractionHierarchy(const struct ContractionHierarchy* hierarchy, const struct Metric* metric, struct SearchState* forward, struct SearchState* backward, struct PriorityQueue* forwardQueue, struct PriorityQueue* backwardQueue, struct BidirectionalResult* result);
+
+int GetHierarchyPath(const struct ContractionHierarchy* hierarchy, const struct SearchState* forward, const struct SearchState* backward, const int meetingVertexId, int* path);
+
+bool WriteContractionHierarchy(const struct ContractionHierarchy* hierarchy, const struct Graph* graph, const struct Metric* metric, const char* fileName);
+
+struct ContractionHierarchy* LoadContractionHierarchy(const char* fileName, const struct Graph* graph, const struct Metric* metric);
+
+void DestroyContractionHierarchy(struct ContractionHierarchy* hierarchy);
+
+#endif
\ No newline at end of file
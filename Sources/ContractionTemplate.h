@@ -0,0 +1,355 @@
+/**
+ * Contraction hierarchies over a path semiring. Included once per semiring by
+ * ContractionHierarchy.c with SEMIRING defined to its prefix (e.g. Additive),
+ * which generates ContractHierarchy<S> and QueryHierarchy<S>. Edge weights are
+ * turned into the metric's space once (Combine(identity, weight)), so paths
+ * and shortcuts are extended with Join. Deliberately has no include guard.
+ */
+#ifndef SEMIRING
+#error "Define SEMIRING before including ContractionTemplate.h"
+#endif
+
+#define CONCAT_(first, second) first ## second
+#define CONCAT(first, second) CONCAT_(first, second)
+#define SEMIRING_FUNCTION(name) CONCAT(SEMIRING, name)
+
+/**
+ * @brief Add the edge sourceId -> targetId of the remaining graph, or make the existing
+ * one better; a worse edge than the existing one is dropped
+ * ! Complexity: O(deg)
+ * @param contraction 
+ * @param sourceId 
+ * @param targetId 
+ * @param weight 
+ * @param middleId 
+ */
+static void CONCAT(AddOrImproveEdge, SEMIRING)(struct Contraction* contraction, const int sourceId, const int targetId, const double weight, const int middleId)
+{
+    struct ContractionList* outList = &contraction -> outLists[sourceId - 1];
+    for (int index = 0 ; index < outList -> size ; index++)
+    {
+        struct ContractionEdge* edge = &outList -> edges[index];
+        if (edge -> vertexId != targetId)
+            continue;
+        if (!SEMIRING_FUNCTION(IsBetter)(weight, edge -> weight))
+            return;
+        edge -> weight = weight;
+        edge -> middleId = middleId;
+        struct ContractionList* inList = &contraction -> inLists[targetId - 1];
+        for (int inIndex = 0 ; inIndex < inList -> size ; inIndex++)
+        {
+            if (inList -> edges[inIndex].vertexId == sourceId)
+            {
+                inList -> edges[inIndex].weight = weight;
+                inList -> edges[inIndex].middleId = middleId;
+                break;
+            }
+        }
+        return;
+    }
+    AppendContractionEdge(outList, targetId, middleId, weight);
+    AppendContractionEdge(&contraction -> inLists[targetId - 1], sourceId, middleId, weight);
+}
+
+/**
+ * @brief Witness search: Dijkstra's algorithm from sourceId over the remaining graph
+ * without contractedId (and without the other vertices of the round if isExcludingRound).
+ * Stops once every queued weight is worse than limitWeight, the worst path through
+ * contractedId it has to beat, once all numberOfTargets targets (the vertices marked
+ * with contractedId) are settled, or after maximumSettled settled vertices.
+ * ! Complexity: O(limit * deg * lg(limit * deg))
+ */
+static void CONCAT(RunWitnessSearch, SEMIRING)(const struct Contraction* contraction, struct SearchState* state, struct PriorityQueue* queue, const int* targetMarks, const int sourceId, const int contractedId, const bool isExcludingRound, const double limitWeight, int numberOfTargets, const int maximumSettled)
+{
+    ResetSearchState(state, sourceId); // ! O(touched vertices)
+    QueueClear(queue);
+    QueueInsert(queue, state, sourceId, SEMIRING_FUNCTION(QueueKey)(state -> sourceWeight));
+    int numberOfSettled = 0;
+    while (QueueSize(queue) > 0 && numberOfSettled < maximumSettled)
+    {
+        const int vertexId = QueueExtractMin(queue, state);
+        numberOfSettled ++;
+        const double vertexWeight = state -> weights[vertexId - 1];
+        if (SEMIRING_FUNCTION(IsBetter)(limitWeight, vertexWeight))
+            break;
+        // Once every target is settled, their weights are final
+        if (targetMarks[vertexId - 1] == contractedId && vertexId != sourceId && -- numberOfTargets == 0)
+            break;
+        const struct ContractionList* outList = &contraction -> outLists[vertexId - 1];
+        for (int index = 0 ; index < outList -> size ; index++)
+        {
+            const int neighbourId = outList -> edges[index].vertexId;
+            if (neighbourId == contractedId || (isExcludingRound && contraction -> isContracting[neighbourId - 1]) || state -> heapIndices[neighbourId - 1] == SETTLED)
+                continue;
+            const double totalWeight = SEMIRING_FUNCTION(Join)(vertexWeight, outList -> edges[index].weight);
+            if (!SEMIRING_FUNCTION(IsBetter)(totalWeight, state -> weights[neighbourId - 1]))
+                continue;
+            if (state -> heapIndices[neighbourId - 1] == UNDISCOVERED)
+                QueueInsert(queue, state, neighbourId, SEMIRING_FUNCTION(QueueKey)(totalWeight));
+            else
+                QueueDecreaseKey(queue, state, neighbourId, SEMIRING_FUNCTION(QueueKey)(totalWeight));
+            state -> weights[neighbourId - 1] = totalWeight;
+        }
+    }
+}
+
+/**
+ * @brief Find the shortcuts contracting vertexId needs: u -> w for every in-neighbour u and
+ * out-neighbour w whose path through vertexId no witness path matches. Adds them to
+ * shortcuts unless it is NULL (when only the priority is wanted).
+ * ! Complexity: O(in-degree * witness search)
+ * @return int number of shortcuts
+ */
+static int CONCAT(FindShortcuts, SEMIRING)(const struct Contraction* contraction, const int vertexId, const int threadIndex, const bool isExcludingRound, struct ShortcutList* shortcuts)
+{
+    const struct ContractionList* inList = &contraction -> inLists[vertexId - 1];
+    const struct ContractionList* outList = &contraction -> outLists[vertexId - 1];
+    struct SearchState* state = contraction -> states[threadIndex];
+    int* targetMarks = contraction -> targetMarks[threadIndex];
+    for (int outIndex = 0 ; outIndex < outList -> size ; outIndex++)
+        targetMarks[outList -> edges[outIndex].vertexId - 1] = vertexId;
+    // Estimating a priority may overcount shortcuts a little, so it gets a cheaper search
+    const int maximumSettled = shortcuts != NULL ? WITNESS_SETTLE_LIMIT : WITNESS_ESTIMATE_SETTLE_LIMIT;
+    int numberOfShortcuts = 0;
+    for (int inIndex = 0 ; inIndex < inList -> size ; inIndex++)
+    {
+        const int sourceId = inList -> edges[inIndex].vertexId;
+        const double inWeight = inList -> edges[inIndex].weight;
+        double limitWeight = state -> sourceWeight;
+        int numberOfTargets = 0;
+        for (int outIndex = 0 ; outIndex < outList -> size ; outIndex++)
+        {
+            if (outList -> edges[outIndex].vertexId == sourceId)
+                continue;
+            const double pathWeight = SEMIRING_FUNCTION(Join)(inWeight, outList -> edges[outIndex].weight);
+            if (numberOfTargets == 0 || SEMIRING_FUNCTION(IsBetter)(limitWeight, pathWeight))
+                limitWeight = pathWeight;
+            numberOfTargets ++;
+        }
+        if (numberOfTargets == 0)
+            continue;
+        CONCAT(RunWitnessSearch, SEMIRING)(contraction, state, contraction -> queues[threadIndex], targetMarks, sourceId, vertexId, isExcludingRound, limitWeight, numberOfTargets, maximumSettled);
+        for (int outIndex = 0 ; outIndex < outList -> size ; outIndex++)
+        {
+            const int targetId = outList -> edges[outIndex].vertexId;
+            if (targetId == sourceId)
+                continue;
+            const double pathWeight = SEMIRING_FUNCTION(Join)(inWeight, outList -> edges[outIndex].weight);
+            if (!SEMIRING_FUNCTION(IsBetter)(pathWeight, state -> weights[targetId - 1]))
+                continue;
+            numberOfShortcuts ++;
+            if (shortcuts != NULL)
+                AppendShortcut(shortcuts, sourceId, targetId, pathWeight);
+        }
+    }
+    return numberOfShortcuts;
+}
+
+/**
+ * @brief Priority of a dirty vertex: its edge difference (shortcuts added minus edges
+ * removed by contracting it) plus its contracted neighbours, which spreads the
+ * contraction evenly over the graph
+ */
+static void CONCAT(ComputePriorityTask, SEMIRING)(void* context, const int taskIndex, const int threadIndex)
+{
+    struct Contraction* contraction = (struct Contraction*) context;
+    const int vertexId = contraction -> dirtyIds[taskIndex];
+    const int numberOfShortcuts = CONCAT(FindShortcuts, SEMIRING)(contraction, vertexId, threadIndex, false, NULL);
+    contraction -> priorities[vertexId - 1] = numberOfShortcuts - contraction -> inLists[vertexId - 1].size - contraction -> outLists[vertexId - 1].size
+        + contraction -> contractedNeighbourCounts[vertexId - 1];
+}
+
+static void CONCAT(ContractTask, SEMIRING)(void* context, const int taskIndex, const int threadIndex)
+{
+    struct Contraction* contraction = (struct Contraction*) context;
+    contraction -> shortcutLists[taskIndex].size = 0;
+    CONCAT(FindShortcuts, SEMIRING)(contraction, contraction -> selectedIds[taskIndex], threadIndex, true, &contraction -> shortcutLists[taskIndex]);
+}
+
+/**
+ * @brief Build a contraction hierarchy in rounds. Each round recomputes the priorities of
+ * the vertices whose neighbourhood changed, picks every remaining vertex whose priority
+ * is lower than all of its neighbours' (an independent set), finds their shortcuts in
+ * parallel (the witness searches avoid the whole set, so no two of them rely on each
+ * other's paths) and then applies the shortcuts and removes the set.
+ * ! Complexity: O(V * in-degree * witness search) in practice
+ * @param graph 
+ * @param metric 
+ * @param pool 
+ * @return struct ContractionHierarchy* 
+ */
+static struct ContractionHierarchy* CONCAT(ContractHierarchy, SEMIRING)(const struct Graph* graph, const struct Metric* metric, struct ThreadPool* pool)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    struct Contraction* contraction = CreateContraction(numberOfVertices, metric, pool);
+
+    // Input edges in the metric's space; parallel edges merge into the best one, self-loops are dropped
+    int* slots = (int*) malloc(numberOfVertices * sizeof(int));
+    int* stamps = (int*) malloc(numberOfVertices * sizeof(int));
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        stamps[index] = 0;
+    for (int vertexId = 1 ; vertexId <= numberOfVertices ; vertexId++)
+    {
+        struct ContractionList* outList = &contraction -> outLists[vertexId - 1];
+        for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < graph -> edgeOffsets[vertexId] ; edge++)
+        {
+            const int targetId = graph -> edgeTargets[edge];
+            const double weight = SEMIRING_FUNCTION(Combine)(metric -> identity, graph -> edgeWeights[edge]);
+            if (targetId == vertexId)
+                continue;
+            if (stamps[targetId - 1] != vertexId)
+            {
+                stamps[targetId - 1] = vertexId;
+                slots[targetId - 1] = outList -> size;
+                AppendContractionEdge(outList, targetId, -1, weight);
+            }
+            else if (SEMIRING_FUNCTION(IsBetter)(weight, outList -> edges[slots[targetId - 1]].weight))
+                outList -> edges[slots[targetId - 1]].weight = weight;
+        }
+    }
+    free(slots);
+    free(stamps);
+    for (int vertexId = 1 ; vertexId <= numberOfVertices ; vertexId++)
+    {
+        const struct ContractionList* outList = &contraction -> outLists[vertexId - 1];
+        for (int index = 0 ; index < outList -> size ; index++)
+            AppendContractionEdge(&contraction -> inLists[outList -> edges[index].vertexId - 1], vertexId, -1, outList -> edges[index].weight);
+    }
+
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        MarkContractionDirty(contraction, index + 1);
+    int numberOfRemaining = numberOfVertices, nextRank = 0;
+    while (numberOfRemaining > 0)
+    {
+        RunTasksWithStealing(pool, contraction -> numberOfDirty, CONCAT(ComputePriorityTask, SEMIRING), contraction);
+        ClearContractionDirty(contraction);
+        SelectIndependentSet(contraction, pool); // ! O(V + E) / threads
+        RunTasksWithStealing(pool, contraction -> numberOfSelected, CONCAT(ContractTask, SEMIRING), contraction);
+        for (int selected = 0 ; selected < contraction -> numberOfSelected ; selected++)
+        {
+            const int vertexId = contraction -> selectedIds[selected];
+            contraction -> ranks[vertexId - 1] = nextRank ++;
+            RemoveContractedVertex(contraction, vertexId);
+        }
+        for (int selected = 0 ; selected < contraction -> numberOfSelected ; selected++)
+        {
+            const struct ShortcutList* shortcuts = &contraction -> shortcutLists[selected];
+            for (int index = 0 ; index < shortcuts -> size ; index++)
+                CONCAT(AddOrImproveEdge, SEMIRING)(contraction, shortcuts -> shortcuts[index].sourceId, shortcuts -> shortcuts[index].targetId, shortcuts -> shortcuts[index].weight, contraction -> selectedIds[selected]);
+            contraction -> isContracting[contraction -> selectedIds[selected] - 1] = false;
+        }
+        numberOfRemaining -= contraction -> numberOfSelected;
+    }
+    struct ContractionHierarchy* hierarchy = CreateHierarchyFromContraction(contraction);
+    DestroyContraction(contraction);
+    return hierarchy;
+}
+
+/**
+ * @brief Join the weights of the input edges a shortcut (or input edge) sourceId -> targetId
+ * stands for onto weight, in path order, so the result equals what a search of the input
+ * graph computes along the same path
+ * ! Complexity: O(unpacked length * deg)
+ */
+static double CONCAT(JoinUnpackedEdge, SEMIRING)(const struct ContractionHierarchy* hierarchy, const int sourceId, const int targetId, const double weight)
+{
+    int middleId;
+    const double edgeWeight = FindHierarchyEdge(hierarchy, sourceId, targetId, &middleId);
+    if (middleId == -1)
+        return SEMIRING_FUNCTION(Join)(weight, edgeWeight);
+    return CONCAT(JoinUnpackedEdge, SEMIRING)(hierarchy, middleId, targetId, CONCAT(JoinUnpackedEdge, SEMIRING)(hierarchy, sourceId, middleId, weight));
+}
+
+static double CONCAT(JoinForwardPath, SEMIRING)(const struct ContractionHierarchy* hierarchy, const struct SearchState* forward, const int vertexId)
+{
+    const int previousVertexId = forward -> previousVertexIds[vertexId - 1];
+    if (previousVertexId == -1)
+        return forward -> sourceWeight;
+    return CONCAT(JoinUnpackedEdge, SEMIRING)(hierarchy, previousVertexId, vertexId, CONCAT(JoinForwardPath, SEMIRING)(hierarchy, forward, previousVertexId));
+}
+
+/**
+ * @brief Settle the next vertex of one direction of a hierarchy query and relax its upward
+ * edges, or stop that direction once its queue holds nothing better than the best path
+ * ! Complexity: O(deg lgV)
+ */
+static void CONCAT(ScanHierarchy, SEMIRING)(const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const struct SearchState* other, double* bestWeight, int* meetingVertexId, bool* isActive, int* numberOfSettled)
+{
+    if (QueueSize(queue) == 0)
+    {
+        *isActive = false;
+        return;
+    }
+    const int vertexId = QueueExtractMin(queue, state);
+    const double vertexWeight = state -> weights[vertexId - 1];
+    if (!SEMIRING_FUNCTION(IsBetter)(vertexWeight, *bestWeight))
+    {
+        *isActive = false;
+        return;
+    }
+    (*numberOfSettled) ++;
+    if (other -> weights[vertexId - 1] != other -> unreachableWeight && SEMIRING_FUNCTION(IsBetter)(SEMIRING_FUNCTION(Join)(vertexWeight, other -> weights[vertexId - 1]), *bestWeight))
+    {
+        *bestWeight = SEMIRING_FUNCTION(Join)(vertexWeight, other -> weights[vertexId - 1]);
+        *meetingVertexId = vertexId;
+    }
+    const int edgeEnd = graph -> edgeOffsets[vertexId];
+    for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < edgeEnd ; edge++)
+    {
+        const int neighbourGraphIndex = graph -> edgeTargets[edge] - 1;
+        if (state -> heapIndices[neighbourGraphIndex] == SETTLED)
+            continue;
+        const double totalWeight = SEMIRING_FUNCTION(Join)(vertexWeight, graph -> edgeWeights[edge]);
+        if (!SEMIRING_FUNCTION(IsBetter)(totalWeight, state -> weights[neighbourGraphIndex]))
+            continue;
+        if (state -> heapIndices[neighbourGraphIndex] == UNDISCOVERED)
+            QueueInsert(queue, state, neighbourGraphIndex + 1, SEMIRING_FUNCTION(QueueKey)(totalWeight));
+        else
+            QueueDecreaseKey(queue, state, neighbourGraphIndex + 1, SEMIRING_FUNCTION(QueueKey)(totalWeight));
+        state -> weights[neighbourGraphIndex] = totalWeight;
+        state -> previousVertexIds[neighbourGraphIndex] = vertexId;
+    }
+}
+
+/**
+ * @brief Hierarchy query between the sources of two freshly reset search states: upward
+ * from the source, and upward from the target over the reversed downward edges, taking
+ * turns. A direction stops once it cannot beat the best meeting found; the best path
+ * peaks at its highest-ranked vertex, which both directions reach. The reported weight
+ * is recomputed along the unpacked path, so it equals what RunDijkstra gives for it.
+ * ! Complexity: O(search space lg(search space)), far less than V on road-like graphs
+ */
+static void CONCAT(QueryHierarchy, SEMIRING)(const struct ContractionHierarchy* hierarchy, struct SearchState* forward, struct SearchState* backward, struct PriorityQueue* forwardQueue, struct PriorityQueue* backwardQueue, struct BidirectionalResult* result)
+{
+    QueueClear(forwardQueue);
+    QueueClear(backwardQueue);
+    QueueInsert(forwardQueue, forward, forward -> sourceId, SEMIRING_FUNCTION(QueueKey)(forward -> sourceWeight));
+    QueueInsert(backwardQueue, backward, backward -> sourceId, SEMIRING_FUNCTION(QueueKey)(backward -> sourceWeight));
+    double bestWeight = forward -> unreachableWeight;
+    int meetingVertexId = -1;
+    bool isForwardActive = true, isBackwardActive = true, isForwardTurn = true;
+    result -> numberOfForwardSettled = 0;
+    result -> numberOfBackwardSettled = 0;
+    while (isForwardActive || isBackwardActive)
+    {
+        if ((isForwardTurn && isForwardActive) || !isBackwardActive)
+            CONCAT(ScanHierarchy, SEMIRING)(hierarchy -> upwardGraph, forward, forwardQueue, backward, &bestWeight, &meetingVertexId, &isForwardActive, &result -> numberOfForwardSettled);
+        else
+            CONCAT(ScanHierarchy, SEMIRING)(hierarchy -> downwardGraph, backward, backwardQueue, forward, &bestWeight, &meetingVertexId, &isBackwardActive, &result -> numberOfBackwardSettled);
+        isForwardTurn = !isForwardTurn;
+    }
+    result -> meetingVertexId = meetingVertexId;
+    result -> weight = bestWeight;
+    if (meetingVertexId == -1)
+        return;
+
+    double weight = CONCAT(JoinForwardPath, SEMIRING)(hierarchy, forward, meetingVertexId);
+    for (int vertexId = meetingVertexId ; backward -> previousVertexIds[vertexId - 1] != -1 ; vertexId = backward -> previousVertexIds[vertexId - 1])
+        weight = CONCAT(JoinUnpackedEdge, SEMIRING)(hierarchy, vertexId, backward -> previousVertexIds[vertexId - 1], weight);
+    result -> weight = weight;
+}
+
+#undef SEMIRING_FUNCTION
+#undef CONCAT
+#undef CONCAT_
+#undef SEMIRING
\ No newline at end of file
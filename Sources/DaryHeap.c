@@ -0,0 +1,216 @@
+#include "PriorityQueue.h"
+#include "Search.h"
+#include <string.h>
+
+/**
+ * d-ary heap with keys stored inline next to the vertex ids, so sifting never
+ * has to look keys up in the search state. The entry array is offset so that
+ * the d children of a node share one aligned block (64 bytes for d = 4).
+ */
+struct HeapEntry {
+    double key;
+    int vertexId;
+};
+
+struct DaryHeap {
+    int numberOfElements;
+    int capacity;
+    struct HeapEntry* entries;
+    void* allocation;
+};
+
+// Private Methods:
+static struct DaryHeap* CreateDaryHeap(const int capacity, const int arity)
+{
+    struct DaryHeap* heap = (struct DaryHeap*) malloc(sizeof(struct DaryHeap));
+    heap -> numberOfElements = 0;
+    heap -> capacity = capacity;
+    size_t size = (capacity + arity) * sizeof(struct HeapEntry);
+    size = (size + 63) / 64 * 64;
+    heap -> allocation = aligned_alloc(64, size);
+    heap -> entries = (struct HeapEntry*) heap -> allocation + (arity - 1);
+    return heap;
+}
+
+/**
+ * @brief Move the entry at index up until its parent's key is not larger
+ * ! Complexity: O(log_d V)
+ */
+static inline void SiftUp(struct DaryHeap* heap, struct SearchState* state, int index, const int arity)
+{
+    struct HeapEntry entry = heap -> entries[index];
+    while (index > 0)
+    {
+        int parentIndex = (index - 1) / arity;
+        if (!(entry.key < heap -> entries[parentIndex].key))
+            break;
+        INSTRUMENT_COUNT(siftSteps);
+        heap -> entries[index] = heap -> entries[parentIndex];
+        state -> heapIndices[heap -> entries[index].vertexId - 1] = index;
+        index = parentIndex;
+    }
+    heap -> entries[index] = entry;
+    state -> heapIndices[entry.vertexId - 1] = index;
+}
+
+/**
+ * @brief Move the entry at index down until no child has a smaller key
+ * ! Complexity: O(d log_d V)
+ */
+static inline void SiftDown(struct DaryHeap* heap, struct SearchState* state, int index, const int arity)
+{
+    const int numberOfElements = heap -> numberOfElements;
+    struct HeapEntry entry = heap -> entries[index];
+    while (true)
+    {
+        int firstChild = index * arity + 1;
+        if (firstChild >= numberOfElements)
+            break;
+        int lastChild = firstChild + arity < numberOfElements ? firstChild + arity : numberOfElements;
+        int bestChild = firstChild;
+        for (int child = firstChild + 1 ; child < lastChild ; child++)
+        {
+            if (heap -> entries[child].key < heap -> entries[bestChild].key)
+                bestChild = child;
+        }
+        if (!(heap -> entries[bestChild].key < entry.key))
+            break;
+        INSTRUMENT_COUNT(siftSteps);
+        heap -> entries[index] = heap -> entries[bestChild];
+        state -> heapIndices[heap -> entries[index].vertexId - 1] = index;
+        index = bestChild;
+    }
+    heap -> entries[index] = entry;
+    state -> heapIndices[entry.vertexId - 1] = index;
+}
+
+static inline int DaryHeapInsert(struct DaryHeap* heap, struct SearchState* state, const int vertexId, const double key, const int arity)
+{
+    if (heap -> numberOfElements >= heap -> capacity)
+        return -1;
+    const int index = heap -> numberOfElements ++;
+    heap -> entries[index].key = key;
+    heap -> entries[index].vertexId = vertexId;
+    SiftUp(heap, state, index, arity);
+    MarkVertexTouched(state, vertexId);
+    return state -> heapIndices[vertexId - 1];
+}
+
+static inline int DaryHeapExtractMin(struct DaryHeap* heap, struct SearchState* state, const int arity)
+{
+    if (heap -> numberOfElements == 0)
+        return -1;
+    const int minVertexId = heap -> entries[0].vertexId;
+    heap -> numberOfElements --;
+    state -> heapIndices[minVertexId - 1] = SETTLED;
+    if (heap -> numberOfElements > 0)
+    {
+        heap -> entries[0] = heap -> entries[heap -> numberOfElements];
+        SiftDown(heap, state, 0, arity);
+    }
+    return minVertexId;
+}
+
+static inline int DaryHeapDecreaseKey(struct DaryHeap* heap, struct SearchState* state, const int vertexId, const double key, const int arity)
+{
+    const int index = state -> heapIndices[vertexId - 1];
+    if (index < 0 || index >= heap -> numberOfElements)
+        return -1;
+    if (!(key < heap -> entries[index].key))
+        return -2;
+    heap -> entries[index].key = key;
+    SiftUp(heap, state, index, arity);
+    return 0;
+}
+
+// Backend Adapters:
+static void* Dary4HeapCreate(const int capacity)
+{
+    return CreateDaryHeap(capacity, 4);
+}
+
+static void* Dary8HeapCreate(const int capacity)
+{
+    return CreateDaryHeap(capacity, 8);
+}
+
+static void DaryHeapClear(void* queue)
+{
+    ((struct DaryHeap*) queue) -> numberOfElements = 0;
+}
+
+static int DaryHeapSize(const void* queue)
+{
+    return ((const struct DaryHeap*) queue) -> numberOfElements;
+}
+
+static int Dary4HeapInsert(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    return DaryHeapInsert((struct DaryHeap*) queue, state, vertexId, key, 4);
+}
+
+static int Dary8HeapInsert(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    return DaryHeapInsert((struct DaryHeap*) queue, state, vertexId, key, 8);
+}
+
+static int Dary4HeapExtractMin(void* queue, struct SearchState* state)
+{
+    return DaryHeapExtractMin((struct DaryHeap*) queue, state, 4);
+}
+
+static int Dary8HeapExtractMin(void* queue, struct SearchState* state)
+{
+    return DaryHeapExtractMin((struct DaryHeap*) queue, state, 8);
+}
+
+static int Dary4HeapDecreaseKey(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    return DaryHeapDecreaseKey((struct DaryHeap*) queue, state, vertexId, key, 4);
+}
+
+static int Dary8HeapDecreaseKey(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    return DaryHeapDecreaseKey((struct DaryHeap*) queue, state, vertexId, key, 8);
+}
+
+static void DaryHeapPrint(const void* queue)
+{
+    const struct DaryHeap* heap = (const struct DaryHeap*) queue;
+    printf("\nQueue - Number of Vertices: %d\n", heap -> numberOfElements);
+    for (int index = 0 ; index < heap -> numberOfElements ; index++)
+    {
+        printf("Index %d: Vertex %d, Key: %lf\n", index, heap -> entries[index].vertexId, heap -> entries[index].key);
+    }
+}
+
+static void DaryHeapDestroy(void* queue)
+{
+    struct DaryHeap* heap = (struct DaryHeap*) queue;
+    free(heap -> allocation);
+    free(heap);
+}
+
+const struct QueueOperations Dary4HeapOperations = {
+    "dary4",
+    Dary4HeapCreate,
+    DaryHeapClear,
+    DaryHeapSize,
+    Dary4HeapInsert,
+    Dary4HeapExtractMin,
+    Dary4HeapDecreaseKey,
+    DaryHeapPrint,
+    DaryHeapDestroy
+};
+
+const struct QueueOperations Dary8HeapOperations = {
+    "dary8",
+    Dary8HeapCreate,
+    DaryHeapClear,
+    DaryHeapSize,
+    Dary8HeapInsert,
+    Dary8HeapExtractMin,
+    Dary8HeapDecreaseKey,
+    DaryHeapPrint,
+    DaryHeapDestroy
+};
\ No newline at end of file
@@ -0,0 +1,440 @@
+#include "DeltaStepping.h"
+#include <string.h>
+
+#define CHUNK_SIZE 64
+
+/**
+ * Shared state of one relaxation step: threads take CHUNK_SIZE vertices of
+ * list at a time and relax their light or heavy edges.
+ */
+struct RelaxStep {
+    struct DeltaStepping* deltaStepping;
+    struct SearchState* state;
+    const struct VertexList* list;
+    long long bucketIndex;
+    bool isHeavy;
+    int nextChunk;
+};
+
+// Private Methods:
+static inline void PushVertex(struct VertexList* list, const int vertexId)
+{
+    if (list -> size == list -> capacity)
+    {
+        list -> capacity = list -> capacity > 0 ? 2 * list -> capacity : 16;
+        list -> vertexIds = (int*) realloc(list -> vertexIds, list -> capacity * sizeof(int));
+    }
+    list -> vertexIds[list -> size ++] = vertexId;
+}
+
+/**
+ * @brief Append the whole source list to the destination list and empty the source
+ * ! Complexity: O(size of source)
+ */
+static void MoveVertices(struct VertexList* destination, struct VertexList* source)
+{
+    if (source -> size == 0)
+        return;
+    const int neededCapacity = destination -> size + source -> size;
+    if (neededCapacity > destination -> capacity)
+    {
+        destination -> capacity = 2 * destination -> capacity > neededCapacity ? 2 * destination -> capacity : neededCapacity;
+        destination -> vertexIds = (int*) realloc(destination -> vertexIds, destination -> capacity * sizeof(int));
+    }
+    memcpy(destination -> vertexIds + destination -> size, source -> vertexIds, source -> size * sizeof(int));
+    destination -> size += source -> size;
+    source -> size = 0;
+}
+
+static inline long long BucketIndexOf(const struct DeltaStepping* deltaStepping, const double weight)
+{
+    return (long long) (weight / deltaStepping -> delta);
+}
+
+static inline struct VertexList* BucketOf(struct DeltaStepping* deltaStepping, const int threadIndex, const long long bucketIndex)
+{
+    return &deltaStepping -> buckets[threadIndex * deltaStepping -> numberOfBuckets + bucketIndex % deltaStepping -> numberOfBuckets];
+}
+
+/**
+ * @brief Lower *address to value unless it is already smaller or equal
+ * ! Complexity: O(1) expected
+ * @return true if this call lowered it
+ */
+static inline bool AtomicMinimum(double* address, double value)
+{
+    double current;
+    __atomic_load(address, &current, __ATOMIC_RELAXED);
+    while (value < current)
+    {
+        if (__atomic_compare_exchange(address, &current, &value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            return true;
+    }
+    return false;
+}
+
+static void RelaxTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    // Threads share the list through nextChunk, so the thread count is not needed
+    (void) numberOfThreads;
+    struct RelaxStep* step = (struct RelaxStep*) context;
+    struct DeltaStepping* deltaStepping = step -> deltaStepping;
+    struct SearchState* state = step -> state;
+    const int* edgeOffsets = deltaStepping -> graph -> edgeOffsets;
+    const int size = step -> list -> size;
+    while (true)
+    {
+        const int begin = __atomic_fetch_add(&step -> nextChunk, CHUNK_SIZE, __ATOMIC_RELAXED);
+        if (begin >= size)
+            break;
+        const int end = begin + CHUNK_SIZE < size ? begin + CHUNK_SIZE : size;
+        for (int position = begin ; position < end ; position++)
+        {
+            const int vertexId = step -> list -> vertexIds[position];
+            double vertexWeight;
+            __atomic_load(&state -> weights[vertexId - 1], &vertexWeight, __ATOMIC_RELAXED);
+            int edge, edgeEnd;
+            if (step -> isHeavy)
+            {
+                edge = deltaStepping -> lightEnds[vertexId - 1];
+                edgeEnd = edgeOffsets[vertexId];
+            }
+            else
+            {
+                // Skip stale bucket entries and vertices already relaxed in this phase
+                if (BucketIndexOf(deltaStepping, vertexWeight) != step -> bucketIndex)
+                    continue;
+                if (__atomic_exchange_n(&deltaStepping -> phases[vertexId - 1], deltaStepping -> phase, __ATOMIC_RELAXED) == deltaStepping -> phase)
+                    continue;
+                if (state -> heapIndices[vertexId - 1] != SETTLED)
+                {
+                    state -> heapIndices[vertexId - 1] = SETTLED;
+                    PushVertex(&deltaStepping -> settledLists[threadIndex], vertexId);
+                }
+                edge = edgeOffsets[vertexId - 1];
+                edgeEnd = deltaStepping -> lightEnds[vertexId - 1];
+            }
+            for ( ; edge < edgeEnd ; edge++)
+            {
+                const int neighbourId = deltaStepping -> edgeTargets[edge];
+                const double totalWeight = vertexWeight + deltaStepping -> edgeWeights[edge];
+                if (AtomicMinimum(&state -> weights[neighbourId - 1], totalWeight))
+                    PushVertex(BucketOf(deltaStepping, threadIndex, BucketIndexOf(deltaStepping, totalWeight)), neighbourId);
+            }
+        }
+    }
+}
+
+static void RunRelaxStep(struct DeltaStepping* deltaStepping, struct SearchState* state, const struct VertexList* list, const long long bucketIndex, const bool isHeavy)
+{
+    struct RelaxStep step = { deltaStepping, state, list, bucketIndex, isHeavy, 0 };
+    RunInParallel(deltaStepping -> pool, RelaxTask, &step);
+}
+
+/**
+ * Shared state of the predecessor pass: every thread owns a contiguous range of vertices.
+ */
+struct ParentStep {
+    const struct DeltaStepping* deltaStepping;
+    struct SearchState* state;
+};
+
+static inline int FirstVertexOfThread(const int numberOfVertices, const int threadIndex, const int numberOfThreads)
+{
+    return (int) ((long long) threadIndex * numberOfVertices / numberOfThreads);
+}
+
+static void ClearParentsTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    struct ParentStep* step = (struct ParentStep*) context;
+    struct SearchState* state = step -> state;
+    const int lastIndex = FirstVertexOfThread(state -> numberOfVertices, threadIndex + 1, numberOfThreads);
+    for (int index = FirstVertexOfThread(state -> numberOfVertices, threadIndex, numberOfThreads) ; index < lastIndex ; index++)
+    {
+        if (state -> heapIndices[index] == SETTLED)
+            state -> previousVertexIds[index] = INT_MAX;
+    }
+}
+
+/**
+ * The predecessor of a settled vertex v is, among the settled u with an edge
+ * u -> v such that weight(u) + edge == weight(v) and weight(u) < weight(v), the
+ * one with the smallest weight and then the smallest id. Dijkstra's algorithm
+ * keeps the first such u it settles, i.e. one of smallest weight, so the two
+ * agree unless several of them tie on weight. This does not depend on the
+ * relaxation order, so results are the same for any number of threads.
+ */
+static inline bool IsBetterParent(const struct SearchState* state, const int vertexId, const int otherVertexId)
+{
+    if (otherVertexId == INT_MAX)
+        return true;
+    const double weight = state -> weights[vertexId - 1];
+    const double otherWeight = state -> weights[otherVertexId - 1];
+    return weight < otherWeight || (weight == otherWeight && vertexId < otherVertexId);
+}
+
+static void ChooseParentsTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    struct ParentStep* step = (struct ParentStep*) context;
+    const struct DeltaStepping* deltaStepping = step -> deltaStepping;
+    struct SearchState* state = step -> state;
+    const int* edgeOffsets = deltaStepping -> graph -> edgeOffsets;
+    const int lastIndex = FirstVertexOfThread(state -> numberOfVertices, threadIndex + 1, numberOfThreads);
+    for (int index = FirstVertexOfThread(state -> numberOfVertices, threadIndex, numberOfThreads) ; index < lastIndex ; index++)
+    {
+        if (state -> heapIndices[index] != SETTLED)
+            continue;
+        const double vertexWeight = state -> weights[index];
+        const int vertexId = index + 1;
+        for (int edge = edgeOffsets[index] ; edge < edgeOffsets[index + 1] ; edge++)
+        {
+            const int neighbourGraphIndex = deltaStepping -> edgeTargets[edge] - 1;
+            const double neighbourWeight = state -> weights[neighbourGraphIndex];
+            if (state -> heapIndices[neighbourGraphIndex] != SETTLED || !(vertexWeight < neighbourWeight) || vertexWeight + deltaStepping -> edgeWeights[edge] != neighbourWeight)
+                continue;
+            int current = __atomic_load_n(&state -> previousVertexIds[neighbourGraphIndex], __ATOMIC_RELAXED);
+            while (IsBetterParent(state, vertexId, current) && !__atomic_compare_exchange_n(&state -> previousVertexIds[neighbourGraphIndex], &current, vertexId, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                ;
+        }
+    }
+}
+
+/**
+ * @brief Fill state -> previousVertexIds for the settled vertices. Vertices only
+ * reachable over zero-weight edges from vertices at the same distance get no
+ * parent in parallel; they are attached by a breadth-first pass over such edges.
+ * ! Complexity: O(V + E) work
+ */
+static void ChooseParents(struct DeltaStepping* deltaStepping, struct SearchState* state)
+{
+    struct ParentStep step = { deltaStepping, state };
+    RunInParallel(deltaStepping -> pool, ClearParentsTask, &step);
+    RunInParallel(deltaStepping -> pool, ChooseParentsTask, &step);
+    state -> previousVertexIds[state -> sourceId - 1] = -1;
+
+    struct VertexList* queue = &deltaStepping -> frontier;
+    queue -> size = 0;
+    bool isMissing = false;
+    for (int index = 0 ; index < state -> numberOfVertices ; index++)
+    {
+        if (state -> heapIndices[index] != SETTLED)
+            continue;
+        if (state -> previousVertexIds[index] == INT_MAX)
+            isMissing = true;
+        else
+            PushVertex(queue, index + 1);
+    }
+    if (!isMissing)
+        return;
+    const int* edgeOffsets = deltaStepping -> graph -> edgeOffsets;
+    for (int head = 0 ; head < queue -> size ; head++)
+    {
+        const int vertexId = queue -> vertexIds[head];
+        for (int edge = edgeOffsets[vertexId - 1] ; edge < edgeOffsets[vertexId] ; edge++)
+        {
+            const int neighbourGraphIndex = deltaStepping -> edgeTargets[edge] - 1;
+            if (state -> heapIndices[neighbourGraphIndex] == SETTLED && state -> previousVertexIds[neighbourGraphIndex] == INT_MAX && state -> weights[vertexId - 1] + deltaStepping -> edgeWeights[edge] == state -> weights[neighbourGraphIndex])
+            {
+                state -> previousVertexIds[neighbourGraphIndex] = vertexId;
+                PushVertex(queue, neighbourGraphIndex + 1);
+            }
+        }
+    }
+    queue -> size = 0;
+}
+
+/**
+ * Shared state of the light/heavy split: every thread owns a contiguous range of vertices.
+ */
+struct SplitStep {
+    struct DeltaStepping* deltaStepping;
+};
+
+static void SplitEdgesTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    struct DeltaStepping* deltaStepping = ((struct SplitStep*) context) -> deltaStepping;
+    const struct Graph* graph = deltaStepping -> graph;
+    const int lastIndex = FirstVertexOfThread(graph -> numberOfVertices, threadIndex + 1, numberOfThreads);
+    for (int index = FirstVertexOfThread(graph -> numberOfVertices, threadIndex, numberOfThreads) ; index < lastIndex ; index++)
+    {
+        // Light edges first, heavy edges after them, each group in graph order
+        int position = graph -> edgeOffsets[index];
+        for (int pass = 0 ; pass < 2 ; pass++)
+        {
+            for (int edge = graph -> edgeOffsets[index] ; edge < graph -> edgeOffsets[index + 1] ; edge++)
+            {
+                if ((graph -> edgeWeights[edge] > deltaStepping -> delta) != pass)
+                    continue;
+                deltaStepping -> edgeTargets[position] = graph -> edgeTargets[edge];
+                deltaStepping -> edgeWeights[position] = graph -> edgeWeights[edge];
+                position++;
+            }
+            if (pass == 0)
+                deltaStepping -> lightEnds[index] = position;
+        }
+    }
+}
+
+// Public Methods:
+/**
+ * @brief Create a DeltaStepping object for the given graph. A delta of 0 picks
+ * the largest edge weight divided by the average out-degree.
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @param pool 
+ * @param delta 
+ * @return struct DeltaStepping* 
+ */
+struct DeltaStepping* CreateDeltaStepping(const struct Graph* graph, struct ThreadPool* pool, const double delta)
+{
+    double maximumWeight = 0.0;
+    for (int edge = 0 ; edge < graph -> numberOfEdges ; edge++)
+    {
+        if (graph -> edgeWeights[edge] < 0.0)
+        {
+            fprintf(stderr, "Delta-stepping needs non-negative edge weights, edge %d has %lf\n", edge, graph -> edgeWeights[edge]);
+            exit(-1);
+        }
+        if (graph -> edgeWeights[edge] > maximumWeight)
+            maximumWeight = graph -> edgeWeights[edge];
+    }
+    struct DeltaStepping* deltaStepping = (struct DeltaStepping*) malloc(sizeof(struct DeltaStepping));
+    deltaStepping -> graph = graph;
+    deltaStepping -> pool = pool;
+    deltaStepping -> delta = delta;
+    if (deltaStepping -> delta <= 0.0 && graph -> numberOfEdges > 0)
+        deltaStepping -> delta = maximumWeight * graph -> numberOfVertices / graph -> numberOfEdges;
+    if (deltaStepping -> delta <= 0.0)
+        deltaStepping -> delta = 1.0;
+    // Live tentative weights lie in [b * delta, (b + 1) * delta + maximumWeight) while bucket b is processed
+    const double numberOfBuckets = maximumWeight / deltaStepping -> delta + 2;
+    if (numberOfBuckets > INT_MAX / pool -> numberOfThreads)
+    {
+        fprintf(stderr, "Delta %lg is too small for a largest edge weight of %lg\n", deltaStepping -> delta, maximumWeight);
+        exit(-1);
+    }
+    deltaStepping -> numberOfBuckets = (int) numberOfBuckets;
+
+    const int numberOfVertices = graph -> numberOfVertices;
+    const int capacity = graph -> numberOfEdges > 0 ? graph -> numberOfEdges : 1;
+    deltaStepping -> lightEnds = (int*) malloc(numberOfVertices * sizeof(int));
+    deltaStepping -> edgeTargets = (int*) malloc(capacity * sizeof(int));
+    deltaStepping -> edgeWeights = (double*) malloc(capacity * sizeof(double));
+    struct SplitStep step = { deltaStepping };
+    RunInParallel(pool, SplitEdgesTask, &step);
+
+    const int numberOfThreads = pool -> numberOfThreads;
+    deltaStepping -> buckets = (struct VertexList*) calloc((size_t) numberOfThreads * deltaStepping -> numberOfBuckets, sizeof(struct VertexList));
+    deltaStepping -> settledLists = (struct VertexList*) calloc(numberOfThreads, sizeof(struct VertexList));
+    memset(&deltaStepping -> frontier, 0, sizeof(struct VertexList));
+    deltaStepping -> phases = (int*) calloc(numberOfVertices, sizeof(int));
+    deltaStepping -> phase = 0;
+    deltaStepping -> numberOfProcessedBuckets = 0;
+    deltaStepping -> numberOfPhases = 0;
+    return deltaStepping;
+}
+
+/**
+ * @brief Compute additive shortest paths from the source of a freshly reset search state.
+ * Gives the same weights as RunDijkstra for the additive metric, and the same
+ * predecessors unless equally short paths leave from equally distant vertices. If targetId is not -1,
+ * the search stops after the bucket that settles the target.
+ * The state's touched list is not kept, so the next reset is a full one.
+ * ! Complexity: O(V + E + buckets * threads) work plus re-relaxations inside a bucket
+ * @param deltaStepping 
+ * @param state 
+ * @param targetId 
+ * @return int number of settled vertices
+ */
+int RunDeltaStepping(struct DeltaStepping* deltaStepping, struct SearchState* state, const int targetId)
+{
+    const int numberOfThreads = deltaStepping -> pool -> numberOfThreads;
+    const int numberOfBuckets = deltaStepping -> numberOfBuckets;
+    for (int bucket = 0 ; bucket < numberOfThreads * numberOfBuckets ; bucket++)
+        deltaStepping -> buckets[bucket].size = 0;
+    deltaStepping -> numberOfProcessedBuckets = 0;
+    deltaStepping -> numberOfPhases = 0;
+    state -> numberOfTouched = -1;
+
+    long long bucketIndex = BucketIndexOf(deltaStepping, state -> weights[state -> sourceId - 1]);
+    PushVertex(BucketOf(deltaStepping, 0, bucketIndex), state -> sourceId);
+    int numberOfSettled = 0;
+    bool isStopped = false;
+    while (true)
+    {
+        // Light phases: relax the current bucket until it stays empty
+        struct VertexList* frontier = &deltaStepping -> frontier;
+        while (true)
+        {
+            frontier -> size = 0;
+            for (int thread = 0 ; thread < numberOfThreads ; thread++)
+                MoveVertices(frontier, BucketOf(deltaStepping, thread, bucketIndex));
+            if (frontier -> size == 0)
+                break;
+            deltaStepping -> phase ++;
+            deltaStepping -> numberOfPhases ++;
+            RunRelaxStep(deltaStepping, state, frontier, bucketIndex, false);
+        }
+
+        // Heavy phase: relax the heavy edges of everything settled in this bucket once
+        frontier -> size = 0;
+        for (int thread = 0 ; thread < numberOfThreads ; thread++)
+            MoveVertices(frontier, &deltaStepping -> settledLists[thread]);
+        numberOfSettled += frontier -> size;
+        RunRelaxStep(deltaStepping, state, frontier, bucketIndex, true);
+        deltaStepping -> numberOfProcessedBuckets ++;
+        if (targetId != -1 && state -> heapIndices[targetId - 1] == SETTLED)
+        {
+            isStopped = true;
+            break;
+        }
+
+        // Move on to the next non-empty bucket
+        long long nextBucketIndex = -1;
+        for (long long candidate = bucketIndex + 1 ; candidate < bucketIndex + numberOfBuckets && nextBucketIndex == -1 ; candidate++)
+        {
+            for (int thread = 0 ; thread < numberOfThreads ; thread++)
+            {
+                if (BucketOf(deltaStepping, thread, candidate) -> size > 0)
+                {
+                    nextBucketIndex = candidate;
+                    break;
+                }
+            }
+        }
+        if (nextBucketIndex == -1)
+            break;
+        bucketIndex = nextBucketIndex;
+    }
+    deltaStepping -> frontier.size = 0;
+    ChooseParents(deltaStepping, state);
+    if (!isStopped)
+    {
+        // Like a search over an eagerly filled queue, a complete search settles the unreachable vertices too
+        for (int index = 0 ; index < state -> numberOfVertices ; index++)
+            state -> heapIndices[index] = SETTLED;
+    }
+    return numberOfSettled;
+}
+
+/**
+ * @brief Deallocate and destroy a DeltaStepping object
+ * ! Complexity: O(threads * buckets)
+ * @param deltaStepping 
+ */
+void DestroyDeltaStepping(struct DeltaStepping* deltaStepping)
+{
+    const int numberOfThreads = deltaStepping -> pool -> numberOfThreads;
+    for (int bucket = 0 ; bucket < numberOfThreads * deltaStepping -> numberOfBuckets ; bucket++)
+        free(deltaStepping -> buckets[bucket].vertexIds);
+    for (int thread = 0 ; thread < numberOfThreads ; thread++)
+        free(deltaStepping -> settledLists[thread].vertexIds);
+    free(deltaStepping -> buckets);
+    free(deltaStepping -> settledLists);
+    free(deltaStepping -> frontier.vertexIds);
+    free(deltaStepping -> phases);
+    free(deltaStepping -> lightEnds);
+    free(deltaStepping -> edgeTargets);
+    free(deltaStepping -> edgeWeights);
+    free(deltaStepping);
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef __DELTASTEPPING_H__
+#define __DELTASTEPPING_H__
+#include "Graph.h"
+#include "Search.h"
+#include "ThreadPool.h"
+#include <stdbool.h>
+
+struct VertexList {
+    int size;
+    int capacity;
+    int* vertexIds;
+};
+
+/**
+ * Parallel delta-stepping for the additive metric (non-negative weights).
+ * Tentative distances are grouped into buckets of width delta. The current
+ * bucket is emptied in phases that relax light edges (weight <= delta) of
+ * all its vertices in parallel, then the heavy edges of every vertex it
+ * settled are relaxed once. Distances are lowered with an atomic minimum
+ * directly in state -> weights. Each thread pushes into its own cyclic
+ * bucket array, so relaxation needs no locks.
+ *
+ * Created once per graph (it keeps a light/heavy split copy of the edges)
+ * and reused for any number of queries on the same thread pool.
+ */
+struct DeltaStepping {
+    const struct Graph* graph;
+    struct ThreadPool* pool;
+    double delta;
+    // Out-edges of v: light ones in [graph offsets[v - 1], lightEnds[v - 1]), heavy ones up to graph offsets[v]
+    int* lightEnds;
+    int* edgeTargets;
+    double* edgeWeights;
+    // Cyclic bucket b % numberOfBuckets of thread t is buckets[t * numberOfBuckets + b % numberOfBuckets]
+    int numberOfBuckets;
+    struct VertexList* buckets;
+    struct VertexList* settledLists;
+    struct VertexList frontier;
+    // Phase in which each vertex was last relaxed, so a vertex queued twice is relaxed once
+    int* phases;
+    int phase;
+    // Statistics of the last query
+    int numberOfProcessedBuckets;
+    int numberOfPhases;
+};
+
+// Public Methods:
+struct DeltaStepping* CreateDeltaStepping(const struct Graph* graph, struct ThreadPool* pool, const double delta);
+
+int RunDeltaStepping(struct DeltaStepping* deltaStepping, struct SearchState* state, const int targetId);
+
+void DestroyDeltaStepping(struct DeltaStepping* deltaStepping);
+
+#endif
\ No newline at end of file
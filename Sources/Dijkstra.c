@@ -0,0 +1,190 @@
+#include "Dijkstra.h"
+#include "Landmarks.h"
+#include "Dynamic.h"
+#include "CompactGraph.h"
+#include "Semiring.h"
+#include "Helper.h"
+#include <string.h>
+
+#define SEMIRING Additive
+#define SEMIRING_HAS_RESIDUAL
+#include "DijkstraTemplate.h"
+
+#define SEMIRING Reliability
+#define SEMIRING_HAS_RESIDUAL
+#include "DijkstraTemplate.h"
+
+#define SEMIRING Widest
+#include "DijkstraTemplate.h"
+
+#define SEMIRING Hops
+#define SEMIRING_HAS_RESIDUAL
+#include "DijkstraTemplate.h"
+
+// Private Methods:
+/**
+ * @brief Fewest-hop search from the source of the given search state as a plain BFS.
+ * The touched-vertex list records vertices in discovery order, which is exactly the
+ * BFS FIFO, so no extra buffer is needed; a queued vertex's heap index is its
+ * position in that list. Stops once targetId (if not -1) is dequeued.
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @param state 
+ * @param targetId 
+ * @return int number of settled vertices
+ */
+static int RunBreadthFirstSearch(const struct Graph* graph, struct SearchState* state, const int targetId)
+{
+    const int sourceId = state -> sourceId;
+    state -> heapIndices[sourceId - 1] = state -> numberOfTouched;
+    MarkVertexTouched(state, sourceId);
+    int head = 0;
+    while (head < state -> numberOfTouched)
+    {
+        const int vertexId = state -> touchedVertexIds[head ++];
+        state -> heapIndices[vertexId - 1] = SETTLED;
+        const double neighbourWeight = HopsCombine(state -> weights[vertexId - 1], 1.0);
+        const int edgeEnd = graph -> edgeOffsets[vertexId];
+        for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < edgeEnd ; edge++)
+        {
+            INSTRUMENT_COUNT(relaxations);
+            const int neighbourGraphIndex = graph -> edgeTargets[edge] - 1;
+            if (state -> heapIndices[neighbourGraphIndex] != UNDISCOVERED)
+                continue;
+            INSTRUMENT_COUNT(improvements);
+            state -> weights[neighbourGraphIndex] = neighbourWeight;
+            state -> previousVertexIds[neighbourGraphIndex] = vertexId;
+            state -> heapIndices[neighbourGraphIndex] = state -> numberOfTouched;
+            MarkVertexTouched(state, neighbourGraphIndex + 1);
+        }
+        if (vertexId == targetId)
+            break;
+    }
+    return head;
+}
+
+const struct Metric METRICS[] = {
+    {"additive", ADDITIVE_IDENTITY, ADDITIVE_UNREACHABLE, InitializePriorityQueueAdditive, RunDijkstraAdditive, NULL, RunBidirectionalAdditive, RunAStarAdditive, RepairShortestPathsAdditive, RunCompactDijkstraAdditive},
+    {"reliability", RELIABILITY_IDENTITY, RELIABILITY_UNREACHABLE, InitializePriorityQueueReliability, RunDijkstraReliability, NULL, RunBidirectionalReliability, RunAStarReliability, RepairShortestPathsReliability, RunCompactDijkstraReliability},
+    {"widest", WIDEST_IDENTITY, WIDEST_UNREACHABLE, InitializePriorityQueueWidest, RunDijkstraWidest, NULL, RunBidirectionalWidest, NULL, RepairShortestPathsWidest, RunCompactDijkstraWidest},
+    {"hops", HOPS_IDENTITY, HOPS_UNREACHABLE, InitializePriorityQueueHops, RunDijkstraHops, RunBreadthFirstSearch, RunBidirectionalHops, RunAStarHops, RepairShortestPathsHops, RunCompactDijkstraHops}
+};
+
+const int NUMBER_OF_METRICS = sizeof(METRICS) / sizeof(METRICS[0]);
+
+// Public Methods:
+/**
+ * @brief Look up a path metric by name
+ * ! Complexity: O(1)
+ * @param name 
+ * @return const struct Metric* (NULL if there is no such metric)
+ */
+const struct Metric* FindMetric(const char* name)
+{
+    for (int index = 0 ; index < NUMBER_OF_METRICS ; index++)
+    {
+        if (strcmp(METRICS[index].name, name) == 0)
+            return &METRICS[index];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Create a SearchState object whose source and unreachable weights follow the metric
+ * ! Complexity: O(1)
+ * @param metric 
+ * @param numberOfVertices 
+ * @return struct SearchState* 
+ */
+struct SearchState* CreateSearchStateForMetric(const struct Metric* metric, const int numberOfVertices)
+{
+    return CreateSearchState(numberOfVertices, metric -> identity, metric -> unreachable);
+}
+
+/**
+ * @brief Write the path found by a bidirectional search, from source to target, into path
+ * (room for V vertices): the forward tree up to the meeting vertex, then the backward tree
+ * ! Complexity: O(path length)
+ * @param forward 
+ * @param backward 
+ * @param meetingVertexId 
+ * @param path 
+ * @return int number of vertices on the path (0 if there is none)
+ */
+int GetBidirectionalPath(const struct SearchState* forward, const struct SearchState* backward, const int meetingVertexId, int* path)
+{
+    if (meetingVertexId == -1)
+        return 0;
+    int length = GetPath(forward, meetingVertexId, path);
+    for (int vertexId = backward -> previousVertexIds[meetingVertexId - 1] ; vertexId != -1 ; vertexId = backward -> previousVertexIds[vertexId - 1])
+        path[length ++] = vertexId;
+    return length;
+}
+
+/**
+ * @brief Answer one query from the source of a freshly reset search state.
+ * Uses the metric's queue-free search if it has one and no queue is given,
+ * Dijkstra's algorithm on the given queue otherwise.
+ * ! Complexity: O(V + E) without a queue, O((V + E)lgV) with one
+ * @param metric 
+ * @param graph 
+ * @param state 
+ * @param queue (may be NULL if metric -> RunWithoutQueue is not NULL)
+ * @param isLazy 
+ * @param targetId 
+ * @return int number of settled vertices
+ */
+int RunMetricQuery(const struct Metric* metric, const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const bool isLazy, const int targetId)
+{
+    InitializeMetricQuery(metric, state, queue, isLazy);
+    return RunInitializedQuery(metric, graph, state, queue, targetId);
+}
+
+/**
+ * @brief First half of RunMetricQuery: fill the queue for a freshly reset search state
+ * (nothing to do without a queue)
+ * ! Complexity: O(VlgV) eager, O(1) lazy or without a queue
+ * @param metric 
+ * @param state 
+ * @param queue (may be NULL if metric -> RunWithoutQueue is not NULL)
+ * @param isLazy 
+ */
+void InitializeMetricQuery(const struct Metric* metric, struct SearchState* state, struct PriorityQueue* queue, const bool isLazy)
+{
+    if (queue != NULL)
+        metric -> InitializePriorityQueue(queue, state, isLazy);
+}
+
+/**
+ * @brief Second half of RunMetricQuery: the search itself, after InitializeMetricQuery
+ * ! Complexity: O(V + E) without a queue, O((V + E)lgV) with one
+ * @param metric 
+ * @param graph 
+ * @param state 
+ * @param queue (may be NULL if metric -> RunWithoutQueue is not NULL)
+ * @param targetId 
+ * @return int number of settled vertices
+ */
+int RunInitializedQuery(const struct Metric* metric, const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const int targetId)
+{
+    if (queue == NULL)
+        return metric -> RunWithoutQueue(graph, state, targetId);
+    return metric -> RunDijkstra(graph, state, queue, targetId);
+}
+
+/**
+ * @brief Answer one query from the source of a freshly reset search state on a CompactGraph
+ * ! Complexity: O((V + E)lgV)
+ * @param metric 
+ * @param graph 
+ * @param state 
+ * @param queue 
+ * @param isLazy 
+ * @param targetId 
+ * @return int number of settled vertices
+ */
+int RunCompactQuery(const struct Metric* metric, const struct CompactGraph* graph, struct SearchState* state, struct PriorityQueue* queue, const bool isLazy, const int targetId)
+{
+    metric -> InitializePriorityQueue(queue, state, isLazy);
+    return metric -> RunCompactDijkstra(graph, state, queue, targetId);
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#ifndef __DIJKSTRA_H__
+#define __DIJKSTRA_H__
+#include "Graph.h"
+#include "Search.h"
+#include "PriorityQueue.h"
+#include <stdbool.h>
+
+struct Landmarks;
+struct EdgeUpdate;
+struct CompactGraph;
+
+struct BidirectionalResult {
+    double weight;          // the metric's unreachable weight if there is no path
+    int meetingVertexId;    // -1 if there is no path
+    int numberOfForwardSettled;
+    int numberOfBackwardSettled;
+};
+
+struct RepairResult {
+    int numberOfAffected;   // vertices whose tree path used a worsened or deleted edge
+    int numberOfSettled;
+};
+
+/**
+ * A path metric: one instantiation of the search engine over a semiring
+ * from Semiring.h. Dispatch happens once per query through this table,
+ * never per relaxation. RunWithoutQueue, when not NULL, is an O(V + E)
+ * search for the same metric that needs no priority queue at all.
+ * RunAStar is NULL for metrics whose Join cannot be inverted (widest),
+ * which admit no landmark bounds. RepairShortestPaths brings a finished
+ * search up to date after a batch of edge updates (see Dynamic.h).
+ * RunCompactDijkstra is RunDijkstra on a CompactGraph.
+ */
+struct Metric {
+    const char* name;
+    double identity;
+    double unreachable;
+    void (*InitializePriorityQueue)(struct PriorityQueue* queue, struct SearchState* state, const bool isLazy);
+    int (*RunDijkstra)(const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const int targetId);
+    int (*RunWithoutQueue)(const struct Graph* graph, struct SearchState* state, const int targetId);
+    void (*RunBidirectional)(const struct Graph* graph, const struct Graph* reverseGraph, struct SearchState* forward, struct SearchState* backward, struct PriorityQueue* forwardQueue, struct PriorityQueue* backwardQueue, struct BidirectionalResult* result);
+    int (*RunAStar)(const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const int targetId, const struct Landmarks* landmarks);
+    void (*RepairShortestPaths)(const struct Graph* graph, const struct Graph* reverseGraph, struct SearchState* state, struct PriorityQueue* queue, const struct EdgeUpdate* updates, const int numberOfUpdates, struct RepairResult* result);
+    int (*RunCompactDijkstra)(const struct CompactGraph* graph, struct SearchState* state, struct PriorityQueue* queue, const int targetId);
+};
+
+extern const struct Metric METRICS[];
+extern const int NUMBER_OF_METRICS;
+
+// Public Methods:
+const struct Metric* FindMetric(const char* name);
+
+struct SearchState* CreateSearchStateForMetric(const struct Metric* metric, const int numberOfVertices);
+
+int GetBidirectionalPath(const struct SearchState* forward, const struct SearchState* backward, const int meetingVertexId, int* path);
+
+int RunMetricQuery(const struct Metric* metric, const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const bool isLazy, const int targetId);
+
+void InitializeMetricQuery(const struct Metric* metric, struct SearchState* state, struct PriorityQueue* queue, const bool isLazy);
+
+int RunInitializedQuery(const struct Metric* metric, const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const int targetId);
+
+int RunCompactQuery(const struct Metric* metric, const struct CompactGraph* graph, struct SearchState* state, struct PriorityQueue* queue, const bool isLazy, const int targetId);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,505 @@
+/**
+ * Dijkstra's algorithm over a path semiring. Included once per semiring by
+ * Dijkstra.c with SEMIRING defined to its prefix (e.g. Additive), which
+ * generates InitializePriorityQueue<S>, RunDijkstra<S>, RunBidirectional<S>,
+ * RepairShortestPaths<S> and RunCompactDijkstra<S>, plus RunAStar<S> if
+ * SEMIRING_HAS_RESIDUAL is also defined. Deliberately has no include guard.
+ */
+#ifndef SEMIRING
+#error "Define SEMIRING before including DijkstraTemplate.h"
+#endif
+
+#define CONCAT_(first, second) first ## second
+#define CONCAT(first, second) CONCAT_(first, second)
+#define SEMIRING_FUNCTION(name) CONCAT(SEMIRING, name)
+
+/**
+ * @brief Fill the given (reusable) priority queue for a freshly reset search state.
+ * Eagerly inserts every vertex, or only the source if isLazy is set; in the lazy
+ * mode the remaining vertices are inserted by RunDijkstra as they are discovered.
+ * ! Complexity: O(VlgV) eager, O(1) lazy
+ * @param queue 
+ * @param state 
+ * @param isLazy 
+ */
+static void CONCAT(InitializePriorityQueue, SEMIRING)(struct PriorityQueue* queue, struct SearchState* state, const bool isLazy)
+{
+    QueueClear(queue);
+    if (isLazy)
+    {
+        QueueInsert(queue, state, state -> sourceId, SEMIRING_FUNCTION(QueueKey)(state -> weights[state -> sourceId - 1])); // ! O(1)
+        return;
+    }
+    for (int index = 0 ; index < state -> numberOfVertices ; index++) // ! O(VlgV)
+    {
+        if (QueueInsert(queue, state, index + 1, SEMIRING_FUNCTION(QueueKey)(state -> weights[index])) == -1) // ! O(lgV)
+        {
+            fprintf(stderr, "Queue is full!");
+            exit(-1);
+        }
+    }
+}
+
+/**
+ * @brief Run Dijkstra's algorithm from the source of the given search state.
+ * If targetId is not -1, the search stops as soon as the target is extracted
+ * from the queue; vertices still in the queue are then left unsettled.
+ * ! Complexity: O((V + E)lgV)
+ * @param graph 
+ * @param state 
+ * @param queue 
+ * @param targetId 
+ * @return int number of settled vertices
+ */
+static int CONCAT(RunDijkstra, SEMIRING)(const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const int targetId)
+{
+    int bestVertex, neighbourId, neighbourHeapIndex, neighbourGraphIndex;
+    double edgeWeight, vertexWeight, neighbourWeight, totalWeight;
+    bool isVisited;
+    int numberOfSettled = 0;
+    while (QueueSize(queue) > 0)
+    {
+        bestVertex = QueueExtractMin(queue, state);
+        numberOfSettled ++;
+        if (SINGLE_STEPPING)
+        {
+            printf("-------------BEGIN--------------\n");
+            QueuePrint(queue);
+            PrintGraph(graph, state);
+            printf("VISITING VERTEX %d\n", bestVertex);
+        }
+        vertexWeight = state -> weights[bestVertex - 1];
+        const int edgeEnd = graph -> edgeOffsets[bestVertex];
+        for (int edge = graph -> edgeOffsets[bestVertex - 1] ; edge < edgeEnd ; edge++)
+        {
+            INSTRUMENT_COUNT(relaxations);
+            neighbourId = graph -> edgeTargets[edge];
+            neighbourGraphIndex = neighbourId - 1;
+            isVisited = state -> heapIndices[neighbourGraphIndex] == SETTLED;
+            if (!isVisited)
+            {
+                if (SINGLE_STEPPING)
+                    printf("Vertex %d is not visited.\n", neighbourId);
+                edgeWeight = graph -> edgeWeights[edge];
+                neighbourWeight = state -> weights[neighbourGraphIndex];
+                totalWeight = SEMIRING_FUNCTION(Combine)(vertexWeight, edgeWeight);
+                if (SINGLE_STEPPING)
+                    printf("Weight: %lf, Neighbour Weight: %lf.\n", totalWeight, neighbourWeight);
+                if (SEMIRING_FUNCTION(IsBetter)(totalWeight, neighbourWeight))
+                {
+                    INSTRUMENT_COUNT(improvements);
+                    neighbourHeapIndex = state -> heapIndices[neighbourGraphIndex];
+                    if (neighbourHeapIndex == UNDISCOVERED)
+                    {
+                        // Lazy queue: first time this vertex is reached
+                        state -> weights[neighbourGraphIndex] = totalWeight;
+                        state -> previousVertexIds[neighbourGraphIndex] = bestVertex;
+                        QueueInsert(queue, state, neighbourId, SEMIRING_FUNCTION(QueueKey)(totalWeight));
+                        continue;
+                    }
+                    int returnValue = QueueDecreaseKey(queue, state, neighbourId, SEMIRING_FUNCTION(QueueKey)(totalWeight));
+                    if (returnValue == 0)
+                    {
+                        state -> weights[neighbourGraphIndex] = totalWeight;
+                        state -> previousVertexIds[neighbourGraphIndex] = bestVertex;
+                    }
+                    else if (returnValue == -1)
+                    {
+                        fprintf(stderr, "Vertex %d with heap index %d is not in the queue of size %d", neighbourId, neighbourHeapIndex, QueueSize(queue)); 
+                        exit(-1);
+                    }
+                    else if (returnValue == -2)
+                    {
+                        fprintf(stderr, "(Source Vertex: %d): Current weight %lf of neighbour vertex %d is already better than %lf!", bestVertex, neighbourWeight, neighbourId, totalWeight); 
+                        exit(-1);
+                    }    
+                    else
+                    {
+                        fprintf(stderr, "Return value is %d for an unknown reason.", returnValue);  
+                        exit(-1);
+                    }   
+                }
+            }
+        }
+        if (SINGLE_STEPPING)
+        {
+            QueuePrint(queue);
+            PrintGraph(graph, state);
+            printf("VISITING VERTEX %d\n-------------END--------------\n", bestVertex);
+        }
+        if (bestVertex == targetId)
+            break;
+    }
+    return numberOfSettled;
+}
+
+/**
+ * @brief Settle the next vertex of one direction of a bidirectional search and relax its
+ * edges in graph (the reverse graph for the backward direction). Whenever a vertex is
+ * reached that the other direction has reached too, the joined weight is a candidate for
+ * the best path.
+ * ! Complexity: O(deg lgV)
+ * @return double weight of the settled vertex
+ */
+static double CONCAT(ScanBidirectional, SEMIRING)(const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const struct SearchState* other, double* bestWeight, int* meetingVertexId)
+{
+    const int vertexId = QueueExtractMin(queue, state);
+    const double vertexWeight = state -> weights[vertexId - 1];
+    if (other -> heapIndices[vertexId - 1] != UNDISCOVERED && SEMIRING_FUNCTION(IsBetter)(SEMIRING_FUNCTION(Join)(vertexWeight, other -> weights[vertexId - 1]), *bestWeight))
+    {
+        *bestWeight = SEMIRING_FUNCTION(Join)(vertexWeight, other -> weights[vertexId - 1]);
+        *meetingVertexId = vertexId;
+    }
+    const int edgeEnd = graph -> edgeOffsets[vertexId];
+    for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < edgeEnd ; edge++)
+    {
+        const int neighbourGraphIndex = graph -> edgeTargets[edge] - 1;
+        if (state -> heapIndices[neighbourGraphIndex] == SETTLED)
+            continue;
+        const double totalWeight = SEMIRING_FUNCTION(Combine)(vertexWeight, graph -> edgeWeights[edge]);
+        if (!SEMIRING_FUNCTION(IsBetter)(totalWeight, state -> weights[neighbourGraphIndex]))
+            continue;
+        if (state -> heapIndices[neighbourGraphIndex] == UNDISCOVERED)
+            QueueInsert(queue, state, neighbourGraphIndex + 1, SEMIRING_FUNCTION(QueueKey)(totalWeight));
+        else
+            QueueDecreaseKey(queue, state, neighbourGraphIndex + 1, SEMIRING_FUNCTION(QueueKey)(totalWeight));
+        state -> weights[neighbourGraphIndex] = totalWeight;
+        state -> previousVertexIds[neighbourGraphIndex] = vertexId;
+        if (other -> heapIndices[neighbourGraphIndex] != UNDISCOVERED && SEMIRING_FUNCTION(IsBetter)(SEMIRING_FUNCTION(Join)(totalWeight, other -> weights[neighbourGraphIndex]), *bestWeight))
+        {
+            *bestWeight = SEMIRING_FUNCTION(Join)(totalWeight, other -> weights[neighbourGraphIndex]);
+            *meetingVertexId = neighbourGraphIndex + 1;
+        }
+    }
+    return vertexWeight;
+}
+
+/**
+ * @brief Bidirectional search between the sources of two freshly reset search states:
+ * forward from forward -> sourceId over graph, backward from backward -> sourceId (the
+ * target) over reverseGraph, always expanding the direction with the smaller queue. Stops
+ * once joining the weights last settled in both directions can no longer beat the best
+ * path found. The reported weight is recomputed along the path from source to target,
+ * so it equals what RunDijkstra gives for the same path.
+ * ! Complexity: O((V + E)lgV), usually far less than a one-directional search
+ * @param graph 
+ * @param reverseGraph 
+ * @param forward 
+ * @param backward 
+ * @param forwardQueue 
+ * @param backwardQueue 
+ * @param result 
+ */
+static void CONCAT(RunBidirectional, SEMIRING)(const struct Graph* graph, const struct Graph* reverseGraph, struct SearchState* forward, struct SearchState* backward, struct PriorityQueue* forwardQueue, struct PriorityQueue* backwardQueue, struct BidirectionalResult* result)
+{
+    CONCAT(InitializePriorityQueue, SEMIRING)(forwardQueue, forward, true);
+    CONCAT(InitializePriorityQueue, SEMIRING)(backwardQueue, backward, true);
+    double bestWeight = forward -> unreachableWeight;
+    int meetingVertexId = -1;
+    double lastForwardWeight = forward -> sourceWeight;
+    double lastBackwardWeight = backward -> sourceWeight;
+    result -> numberOfForwardSettled = 0;
+    result -> numberOfBackwardSettled = 0;
+    while (QueueSize(forwardQueue) > 0 && QueueSize(backwardQueue) > 0)
+    {
+        if (meetingVertexId != -1 && !SEMIRING_FUNCTION(IsBetter)(SEMIRING_FUNCTION(Join)(lastForwardWeight, lastBackwardWeight), bestWeight))
+            break;
+        if (QueueSize(forwardQueue) <= QueueSize(backwardQueue))
+        {
+            lastForwardWeight = CONCAT(ScanBidirectional, SEMIRING)(graph, forward, forwardQueue, backward, &bestWeight, &meetingVertexId);
+            result -> numberOfForwardSettled ++;
+        }
+        else
+        {
+            lastBackwardWeight = CONCAT(ScanBidirectional, SEMIRING)(reverseGraph, backward, backwardQueue, forward, &bestWeight, &meetingVertexId);
+            result -> numberOfBackwardSettled ++;
+        }
+    }
+    result -> meetingVertexId = meetingVertexId;
+    result -> weight = bestWeight;
+    if (meetingVertexId == -1)
+        return;
+
+    // Extend the forward weight of the meeting vertex edge by edge towards the target
+    double weight = forward -> weights[meetingVertexId - 1];
+    for (int vertexId = meetingVertexId ; vertexId != backward -> sourceId ; vertexId = backward -> previousVertexIds[vertexId - 1])
+    {
+        const int nextVertexId = backward -> previousVertexIds[vertexId - 1];
+        double bestEdgeWeight = forward -> unreachableWeight;
+        for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < graph -> edgeOffsets[vertexId] ; edge++)
+        {
+            const double edgeWeight = SEMIRING_FUNCTION(Combine)(weight, graph -> edgeWeights[edge]);
+            if (graph -> edgeTargets[edge] == nextVertexId && SEMIRING_FUNCTION(IsBetter)(edgeWeight, bestEdgeWeight))
+                bestEdgeWeight = edgeWeight;
+        }
+        weight = bestEdgeWeight;
+    }
+    result -> weight = weight;
+}
+
+/**
+ * @brief Give a vertex a better weight through previousVertexId during a repair, queueing
+ * it again if it has left the queue (or never entered it)
+ * ! Complexity: O(lgV)
+ */
+static inline void CONCAT(ImproveVertex, SEMIRING)(struct SearchState* state, struct PriorityQueue* queue, const int vertexId, const double weight, const int previousVertexId)
+{
+    INSTRUMENT_COUNT(improvements);
+    state -> weights[vertexId - 1] = weight;
+    state -> previousVertexIds[vertexId - 1] = previousVertexId;
+    if (state -> heapIndices[vertexId - 1] >= 0)
+        QueueDecreaseKey(queue, state, vertexId, SEMIRING_FUNCTION(QueueKey)(weight));
+    else
+        QueueInsert(queue, state, vertexId, SEMIRING_FUNCTION(QueueKey)(weight));
+}
+
+/**
+ * @brief RunDijkstra on a CompactGraph: the edges of a settled vertex are decoded from
+ * its byte stream as they are relaxed, in increasing target order
+ * ! Complexity: O((V + E)lgV)
+ * @param graph 
+ * @param state 
+ * @param queue 
+ * @param targetId 
+ * @return int number of settled vertices
+ */
+static int CONCAT(RunCompactDijkstra, SEMIRING)(const struct CompactGraph* graph, struct SearchState* state, struct PriorityQueue* queue, const int targetId)
+{
+    int numberOfSettled = 0;
+    while (QueueSize(queue) > 0)
+    {
+        const int vertexId = QueueExtractMin(queue, state);
+        numberOfSettled ++;
+        const double vertexWeight = state -> weights[vertexId - 1];
+        const unsigned char* cursor = graph -> bytes + graph -> byteOffsets[vertexId - 1];
+        const unsigned char* end = graph -> bytes + graph -> byteOffsets[vertexId];
+        int neighbourId = vertexId;
+        for (bool isFirst = true ; cursor < end ; isFirst = false)
+        {
+            const double edgeWeight = ReadCompactEdge(graph, &cursor, &neighbourId, isFirst);
+            INSTRUMENT_COUNT(relaxations);
+            if (state -> heapIndices[neighbourId - 1] == SETTLED)
+                continue;
+            const double totalWeight = SEMIRING_FUNCTION(Combine)(vertexWeight, edgeWeight);
+            if (SEMIRING_FUNCTION(IsBetter)(totalWeight, state -> weights[neighbourId - 1]))
+                CONCAT(ImproveVertex, SEMIRING)(state, queue, neighbourId, totalWeight, vertexId); // ! O(lgV)
+        }
+        if (vertexId == targetId)
+            break;
+    }
+    return numberOfSettled;
+}
+
+/**
+ * @brief Repair the shortest-path tree of a search that ran to completion (no target)
+ * after ApplyEdgeUpdates changed the graph, in the style of Ramalingam and Reps:
+ * 1. a vertex whose tree edge was deleted or no longer gives it its weight loses its
+ *    weight, and so does its whole subtree (the affected vertices);
+ * 2. each affected vertex gets the best weight its unaffected in-neighbours offer;
+ * 3. each updated edge that now improves its target's weight does so;
+ * 4. Dijkstra's algorithm from the vertices queued by 2 and 3 spreads the changes.
+ * Only the affected vertices, the improved vertices and their edges are touched. The
+ * state's touched list is given up, so its next ResetSearchState is a full one.
+ * ! Complexity: O(updates + (affected + improved) * deg * lgV)
+ * @param graph (already updated)
+ * @param reverseGraph (already updated)
+ * @param state 
+ * @param queue 
+ * @param updates (normalized by ApplyEdgeUpdates: one update per edge)
+ * @param numberOfUpdates 
+ * @param result 
+ */
+static void CONCAT(RepairShortestPaths, SEMIRING)(const struct Graph* graph, const struct Graph* reverseGraph, struct SearchState* state, struct PriorityQueue* queue, const struct EdgeUpdate* updates, const int numberOfUpdates, struct RepairResult* result)
+{
+    // Vertices may now enter the queue more than once, which the touched list cannot hold
+    state -> numberOfTouched = -1;
+    QueueClear(queue);
+    int* affectedIds = (int*) malloc(state -> numberOfVertices * sizeof(int));
+    int numberOfAffected = 0;
+    for (int index = 0 ; index < numberOfUpdates ; index++)
+    {
+        const struct EdgeUpdate* update = &updates[index];
+        const int dstIndex = update -> dstId - 1;
+        if (state -> previousVertexIds[dstIndex] != update -> srcId)
+            continue;
+        if (!update -> isDeletion && !SEMIRING_FUNCTION(IsBetter)(state -> weights[dstIndex], SEMIRING_FUNCTION(Combine)(state -> weights[update -> srcId - 1], update -> weight)))
+            continue;
+        state -> weights[dstIndex] = state -> unreachableWeight;
+        state -> previousVertexIds[dstIndex] = -1;
+        affectedIds[numberOfAffected ++] = update -> dstId;
+    }
+    // The list doubles as the queue of a BFS over the tree edges: every vertex whose
+    // previous vertex is affected is affected too
+    for (int next = 0 ; next < numberOfAffected ; next++)
+    {
+        const int vertexId = affectedIds[next];
+        for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < graph -> edgeOffsets[vertexId] ; edge++)
+        {
+            const int childIndex = graph -> edgeTargets[edge] - 1;
+            if (state -> previousVertexIds[childIndex] != vertexId)
+                continue;
+            state -> weights[childIndex] = state -> unreachableWeight;
+            state -> previousVertexIds[childIndex] = -1;
+            affectedIds[numberOfAffected ++] = childIndex + 1;
+        }
+    }
+    for (int affected = 0 ; affected < numberOfAffected ; affected++)
+    {
+        const int vertexId = affectedIds[affected];
+        double bestWeight = state -> unreachableWeight;
+        int bestPreviousId = -1;
+        for (int edge = reverseGraph -> edgeOffsets[vertexId - 1] ; edge < reverseGraph -> edgeOffsets[vertexId] ; edge++)
+        {
+            const int previousId = reverseGraph -> edgeTargets[edge];
+            const double weight = SEMIRING_FUNCTION(Combine)(state -> weights[previousId - 1], reverseGraph -> edgeWeights[edge]);
+            if (SEMIRING_FUNCTION(IsBetter)(weight, bestWeight))
+            {
+                bestWeight = weight;
+                bestPreviousId = previousId;
+            }
+        }
+        state -> heapIndices[vertexId - 1] = UNDISCOVERED;
+        if (bestPreviousId != -1)
+            CONCAT(ImproveVertex, SEMIRING)(state, queue, vertexId, bestWeight, bestPreviousId);
+    }
+    free(affectedIds);
+    for (int index = 0 ; index < numberOfUpdates ; index++)
+    {
+        const struct EdgeUpdate* update = &updates[index];
+        if (update -> isDeletion)
+            continue;
+        const double weight = SEMIRING_FUNCTION(Combine)(state -> weights[update -> srcId - 1], update -> weight);
+        if (SEMIRING_FUNCTION(IsBetter)(weight, state -> weights[update -> dstId - 1]))
+            CONCAT(ImproveVertex, SEMIRING)(state, queue, update -> dstId, weight, update -> srcId);
+    }
+
+    // Keys leave the queue in order, so a vertex extracted here is final and no longer improves
+    int numberOfSettled = 0;
+    while (QueueSize(queue) > 0)
+    {
+        const int vertexId = QueueExtractMin(queue, state);
+        numberOfSettled ++;
+        const double vertexWeight = state -> weights[vertexId - 1];
+        for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < graph -> edgeOffsets[vertexId] ; edge++)
+        {
+            INSTRUMENT_COUNT(relaxations);
+            const int neighbourId = graph -> edgeTargets[edge];
+            const double weight = SEMIRING_FUNCTION(Combine)(vertexWeight, graph -> edgeWeights[edge]);
+            if (SEMIRING_FUNCTION(IsBetter)(weight, state -> weights[neighbourId - 1]))
+                CONCAT(ImproveVertex, SEMIRING)(state, queue, neighbourId, weight, vertexId);
+        }
+    }
+    result -> numberOfAffected = numberOfAffected;
+    result -> numberOfSettled = numberOfSettled;
+}
+#ifdef SEMIRING_HAS_RESIDUAL
+/**
+ * @brief ALT bound on the weight of the best path from a vertex to the target: by the
+ * triangle inequality through each landmark L, that path can be no better than
+ * Residual(L -> target, L -> vertex) nor Residual(vertex -> L, target -> L); the least
+ * optimistic of these is the bound. Returns the unreachable weight when a landmark
+ * proves the target cannot be reached from the vertex.
+ * ! Complexity: O(k)
+ * @param landmarks 
+ * @param state 
+ * @param vertexId 
+ * @param targetId 
+ * @return double 
+ */
+static inline double CONCAT(LandmarkBound, SEMIRING)(const struct Landmarks* landmarks, const struct SearchState* state, const int vertexId, const int targetId)
+{
+    const int numberOfLandmarks = landmarks -> numberOfLandmarks;
+    const double* vertexFromWeights = landmarks -> fromWeights + (size_t) (vertexId - 1) * numberOfLandmarks;
+    const double* vertexToWeights = landmarks -> toWeights + (size_t) (vertexId - 1) * numberOfLandmarks;
+    const double* targetFromWeights = landmarks -> fromWeights + (size_t) (targetId - 1) * numberOfLandmarks;
+    const double* targetToWeights = landmarks -> toWeights + (size_t) (targetId - 1) * numberOfLandmarks;
+    const double unreachableWeight = state -> unreachableWeight;
+    double bound = state -> sourceWeight;
+    for (int landmark = 0 ; landmark < numberOfLandmarks ; landmark++)
+    {
+        if (vertexFromWeights[landmark] != unreachableWeight)
+        {
+            if (targetFromWeights[landmark] == unreachableWeight)
+                return unreachableWeight;
+            const double residual = SEMIRING_FUNCTION(Residual)(targetFromWeights[landmark], vertexFromWeights[landmark]);
+            if (SEMIRING_FUNCTION(IsBetter)(bound, residual))
+                bound = residual;
+        }
+        if (targetToWeights[landmark] != unreachableWeight)
+        {
+            if (vertexToWeights[landmark] == unreachableWeight)
+                return unreachableWeight;
+            const double residual = SEMIRING_FUNCTION(Residual)(vertexToWeights[landmark], targetToWeights[landmark]);
+            if (SEMIRING_FUNCTION(IsBetter)(bound, residual))
+                bound = residual;
+        }
+    }
+    return bound;
+}
+
+/**
+ * @brief A* search from the source of a freshly reset search state to targetId: the
+ * relaxation loop of RunDijkstra with every queue key raised by the ALT bound of the
+ * vertex (Join(weight, bound)). The bounds are consistent, so every extracted vertex is
+ * final; vertices a landmark proves to be dead ends are never queued. Keys are clamped
+ * to the largest one extracted so far, so rounding cannot break monotone queues.
+ * ! Complexity: O((V + E)(lgV + k)) worst case, usually a small part of the graph
+ * @param graph 
+ * @param state 
+ * @param queue 
+ * @param targetId 
+ * @param landmarks 
+ * @return int number of settled vertices
+ */
+static int CONCAT(RunAStar, SEMIRING)(const struct Graph* graph, struct SearchState* state, struct PriorityQueue* queue, const int targetId, const struct Landmarks* landmarks)
+{
+    QueueClear(queue);
+    const double sourceBound = CONCAT(LandmarkBound, SEMIRING)(landmarks, state, state -> sourceId, targetId);
+    if (sourceBound == state -> unreachableWeight)
+        return 0;
+    QueueInsert(queue, state, state -> sourceId, SEMIRING_FUNCTION(QueueKey)(SEMIRING_FUNCTION(Join)(state -> sourceWeight, sourceBound)));
+    double lastKey = -INFINITY;
+    int numberOfSettled = 0;
+    while (QueueSize(queue) > 0)
+    {
+        const int vertexId = QueueExtractMin(queue, state);
+        numberOfSettled ++;
+        if (vertexId == targetId)
+            break;
+        const double vertexWeight = state -> weights[vertexId - 1];
+        // Never below any key extracted so far: this vertex's key, unless an earlier clamp raised it
+        const double vertexKey = SEMIRING_FUNCTION(QueueKey)(SEMIRING_FUNCTION(Join)(vertexWeight, CONCAT(LandmarkBound, SEMIRING)(landmarks, state, vertexId, targetId)));
+        if (vertexKey > lastKey)
+            lastKey = vertexKey;
+        const int edgeEnd = graph -> edgeOffsets[vertexId];
+        for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < edgeEnd ; edge++)
+        {
+            const int neighbourGraphIndex = graph -> edgeTargets[edge] - 1;
+            if (state -> heapIndices[neighbourGraphIndex] == SETTLED)
+                continue;
+            const double totalWeight = SEMIRING_FUNCTION(Combine)(vertexWeight, graph -> edgeWeights[edge]);
+            if (!SEMIRING_FUNCTION(IsBetter)(totalWeight, state -> weights[neighbourGraphIndex]))
+                continue;
+            const double bound = CONCAT(LandmarkBound, SEMIRING)(landmarks, state, neighbourGraphIndex + 1, targetId);
+            if (bound == state -> unreachableWeight)
+                continue;
+            double key = SEMIRING_FUNCTION(QueueKey)(SEMIRING_FUNCTION(Join)(totalWeight, bound));
+            if (key < lastKey)
+                key = lastKey;
+            if (state -> heapIndices[neighbourGraphIndex] == UNDISCOVERED)
+                QueueInsert(queue, state, neighbourGraphIndex + 1, key);
+            else
+                QueueDecreaseKey(queue, state, neighbourGraphIndex + 1, key);
+            state -> weights[neighbourGraphIndex] = totalWeight;
+            state -> previousVertexIds[neighbourGraphIndex] = vertexId;
+        }
+    }
+    return numberOfSettled;
+}
+#endif
+
+#undef SEMIRING_FUNCTION
+#undef CONCAT
+#undef CONCAT_
+#undef SEMIRING
+#undef SEMIRING_HAS_RESIDUAL
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include "Dynamic.h"
+#include "Arena.h"
+#include <string.h>
+
+// Private Methods:
+/**
+ * @brief Check the vertex ids of the updates, then group them by source (a stable counting
+ * sort) and drop every update that a later one of the same edge overrides
+ * ! Complexity: O(V + updates)
+ * @param updateList 
+ * @param numberOfVertices 
+ */
+static void NormalizeUpdates(struct UpdateList* updateList, const int numberOfVertices)
+{
+    const int numberOfUpdates = updateList -> numberOfUpdates;
+    int* offsets = (int*) calloc(numberOfVertices + 1, sizeof(int));
+    for (int index = 0 ; index < numberOfUpdates ; index++)
+    {
+        const struct EdgeUpdate* update = &updateList -> updates[index];
+        if (update -> srcId < 1 || update -> srcId > numberOfVertices || update -> dstId < 1 || update -> dstId > numberOfVertices)
+        {
+            fprintf(stderr, "Update %d -> %d: vertices must be between 1 and %d\n", update -> srcId, update -> dstId, numberOfVertices);
+            exit(-1);
+        }
+        offsets[update -> srcId] ++;
+    }
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        offsets[index + 1] += offsets[index];
+    struct EdgeUpdate* sorted = (struct EdgeUpdate*) malloc((numberOfUpdates > 0 ? numberOfUpdates : 1) * sizeof(struct EdgeUpdate));
+    for (int index = 0 ; index < numberOfUpdates ; index++)
+        sorted[offsets[updateList -> updates[index].srcId - 1] ++] = updateList -> updates[index];
+
+    // Walk the groups backwards so that the last update of an edge is the one seen first
+    int* lastSourceIds = (int*) calloc(numberOfVertices, sizeof(int));
+    int numberOfKept = 0;
+    for (int end = numberOfUpdates ; end > 0 ; end--)
+    {
+        const struct EdgeUpdate* update = &sorted[end - 1];
+        if (lastSourceIds[update -> dstId - 1] == update -> srcId)
+            continue;
+        lastSourceIds[update -> dstId - 1] = update -> srcId;
+        updateList -> updates[numberOfKept ++] = *update;
+    }
+    updateList -> numberOfUpdates = numberOfKept;
+    free(lastSourceIds);
+    free(sorted);
+    free(offsets);
+}
+
+/**
+ * @brief Apply normalized updates to one graph, or to the reverse graph with the ends of
+ * every edge swapped. Weight changes are made in place; if edges are inserted or deleted,
+ * the CSR arrays are rebuilt once for the whole batch, each vertex keeping its remaining
+ * edges in order followed by its new ones.
+ * ! Complexity: O(updates * deg) for weight changes only, O(V + E + updates * deg) otherwise
+ * @param graph 
+ * @param updates 
+ * @param numberOfUpdates 
+ * @param isReverse 
+ * @param statistics (NULL: do not count)
+ */
+static void ApplyToGraph(struct Graph* graph, const struct EdgeUpdate* updates, const int numberOfUpdates, const bool isReverse, struct UpdateStatistics* statistics)
+{
+    MakeGraphWritable(graph); // ! O(V + E) for a snapshot, O(1) otherwise
+    const int numberOfVertices = graph -> numberOfVertices;
+    bool* isInsertion = (bool*) calloc(numberOfUpdates > 0 ? numberOfUpdates : 1, sizeof(bool));
+    int* insertionCounts = NULL;
+    int numberOfInsertedEdges = 0, numberOfDeletedEdges = 0;
+    for (int index = 0 ; index < numberOfUpdates ; index++)
+    {
+        const struct EdgeUpdate* update = &updates[index];
+        const int fromId = isReverse ? update -> dstId : update -> srcId;
+        const int toId = isReverse ? update -> srcId : update -> dstId;
+        bool isFound = false;
+        for (int edge = graph -> edgeOffsets[fromId - 1] ; edge < graph -> edgeOffsets[fromId] ; edge++)
+        {
+            if (graph -> edgeTargets[edge] != toId)
+                continue;
+            isFound = true;
+            if (update -> isDeletion)
+            {
+                // Vertex ids start at 1, so 0 marks the edge for removal by the rebuild
+                graph -> edgeTargets[edge] = 0;
+                numberOfDeletedEdges ++;
+            }
+            else
+                graph -> edgeWeights[edge] = update -> weight;
+        }
+        if (statistics != NULL)
+        {
+            if (update -> isDeletion && isFound)
+                statistics -> numberOfDeleted ++;
+            else if (update -> isDeletion)
+                statistics -> numberOfMissing ++;
+            else if (isFound)
+                statistics -> numberOfChanged ++;
+            else
+                statistics -> numberOfInserted ++;
+        }
+        if (isFound || update -> isDeletion)
+            continue;
+        if (insertionCounts == NULL)
+            insertionCounts = (int*) calloc(numberOfVertices + 1, sizeof(int));
+        insertionCounts[fromId] ++;
+        isInsertion[index] = true;
+        numberOfInsertedEdges ++;
+    }
+    if (numberOfInsertedEdges == 0 && numberOfDeletedEdges == 0)
+    {
+        free(isInsertion);
+        return;
+    }
+
+    // The new arrays get an arena of their own; the old one goes once they are copied
+    const int* oldEdgeOffsets = graph -> edgeOffsets;
+    const int* oldEdgeTargets = graph -> edgeTargets;
+    const double* oldEdgeWeights = graph -> edgeWeights;
+    struct Arena* oldArena = graph -> arena;
+    graph -> numberOfEdges = graph -> numberOfEdges - numberOfDeletedEdges + numberOfInsertedEdges;
+    AllocateGraphArrays(graph);
+    int* edgeOffsets = graph -> edgeOffsets;
+    int* edgeTargets = graph -> edgeTargets;
+    double* edgeWeights = graph -> edgeWeights;
+    int position = 0;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        edgeOffsets[index] = position;
+        for (int edge = oldEdgeOffsets[index] ; edge < oldEdgeOffsets[index + 1] ; edge++)
+        {
+            if (oldEdgeTargets[edge] == 0)
+                continue;
+            edgeTargets[position] = oldEdgeTargets[edge];
+            edgeWeights[position ++] = oldEdgeWeights[edge];
+        }
+        // From here on insertionCounts[v] is where the next new edge of v goes
+        const int numberOfNewEdges = insertionCounts != NULL ? insertionCounts[index + 1] : 0;
+        if (insertionCounts != NULL)
+            insertionCounts[index + 1] = position;
+        position += numberOfNewEdges;
+    }
+    edgeOffsets[numberOfVertices] = position;
+    for (int index = 0 ; index < numberOfUpdates ; index++)
+    {
+        if (!isInsertion[index])
+            continue;
+        const int fromId = isReverse ? updates[index].dstId : updates[index].srcId;
+        const int slot = insertionCounts[fromId] ++;
+        edgeTargets[slot] = isReverse ? updates[index].srcId : updates[index].dstId;
+        edgeWeights[slot] = updates[index].weight;
+    }
+    DestroyArena(oldArena);
+    free(insertionCounts);
+    free(isInsertion);
+}
+
+// Public Methods:
+/**
+ * @brief Read an update file: one "source target weight" line per edge to insert or
+ * reweight and one "source target" line per edge to delete; blank lines and lines
+ * starting with % or # are skipped
+ * ! Complexity: O(file size)
+ * @param fileName 
+ * @return struct UpdateList* 
+ */
+struct UpdateList* ReadUpdateFile(const char* fileName)
+{
+    FILE* file = fopen(fileName, "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open file %s\n", fileName);
+        exit(-1);
+    }
+    struct UpdateList* updateList = (struct UpdateList*) malloc(sizeof(struct UpdateList));
+    updateList -> numberOfUpdates = 0;
+    updateList -> capacity = 16;
+    updateList -> updates = (struct EdgeUpdate*) malloc(updateList -> capacity * sizeof(struct EdgeUpdate));
+    char line[256];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        lineNumber++;
+        int srcId, dstId;
+        double weight = 0.0;
+        char first = '\0';
+        if (sscanf(line, " %c", &first) != 1 || first == '%' || first == '#')
+            continue;
+        // consumed ends after the last field read, so anything left but spaces is junk
+        int consumed = 0;
+        const int numberOfFields = sscanf(line, "%d %d%n %lf%n", &srcId, &dstId, &consumed, &weight, &consumed);
+        if (numberOfFields < 2 || line[consumed + strspn(line + consumed, " \t\r\n")] != '\0')
+        {
+            fprintf(stderr, "%s:%d: expected \"source target [weight]\"\n", fileName, lineNumber);
+            exit(-1);
+        }
+        if (updateList -> numberOfUpdates == updateList -> capacity)
+        {
+            updateList -> capacity *= 2;
+            updateList -> updates = (struct EdgeUpdate*) realloc(updateList -> updates, updateList -> capacity * sizeof(struct EdgeUpdate));
+        }
+        struct EdgeUpdate* update = &updateList -> updates[updateList -> numberOfUpdates ++];
+        update -> srcId = srcId;
+        update -> dstId = dstId;
+        update -> weight = weight;
+        update -> isDeletion = numberOfFields == 2;
+    }
+    fclose(file);
+    return updateList;
+}
+
+/**
+ * @brief Deallocate and destroy an UpdateList object
+ * ! Complexity: O(1)
+ * @param updateList 
+ */
+void DestroyUpdateList(struct UpdateList* updateList)
+{
+    free(updateList -> updates);
+    free(updateList);
+}
+
+/**
+ * @brief Apply a batch of edge updates to a graph and its reverse graph (which may be NULL).
+ * The list is normalized first: grouped by source, with only the last update of each edge
+ * kept, which is also the form RepairShortestPaths expects. A graph mapped from a snapshot
+ * gets its own copy of the arrays; the snapshot file is never changed.
+ * ! Complexity: O(V + updates * deg), plus O(V + E) if edges are inserted or deleted
+ * @param graph 
+ * @param reverseGraph 
+ * @param updateList 
+ * @param statistics 
+ */
+void ApplyEdgeUpdates(struct Graph* graph, struct Graph* reverseGraph, struct UpdateList* updateList, struct UpdateStatistics* statistics)
+{
+    NormalizeUpdates(updateList, graph -> numberOfVertices); // ! O(V + updates)
+    memset(statistics, 0, sizeof(struct UpdateStatistics));
+    ApplyToGraph(graph, updateList -> updates, updateList -> numberOfUpdates, false, statistics);
+    if (reverseGraph != NULL)
+        ApplyToGraph(reverseGraph, updateList -> updates, updateList -> numberOfUpdates, true, NULL);
+}
\ No newline at end of file
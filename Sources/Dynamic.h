@@ -0,0 +1,39 @@
+#ifndef __DYNAMIC_H__
+#define __DYNAMIC_H__
+#include "Graph.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+/**
+ * One change of a batch: set the weight of srcId -> dstId (inserting the
+ * edge if it is missing), or delete it. Parallel edges count as one edge:
+ * a weight change sets all of them and a deletion removes all of them.
+ */
+struct EdgeUpdate {
+    int srcId;
+    int dstId;
+    double weight;      // unused for a deletion
+    bool isDeletion;
+};
+
+struct UpdateList {
+    int numberOfUpdates;
+    int capacity;
+    struct EdgeUpdate* updates;
+};
+
+struct UpdateStatistics {
+    int numberOfChanged;    // existing edges that got a new weight
+    int numberOfInserted;
+    int numberOfDeleted;
+    int numberOfMissing;    // deletions of edges that did not exist
+};
+
+// Public Methods:
+struct UpdateList* ReadUpdateFile(const char* fileName);
+
+void DestroyUpdateList(struct UpdateList* updateList);
+
+void ApplyEdgeUpdates(struct Graph* graph, struct Graph* reverseGraph, struct UpdateList* updateList, struct UpdateStatistics* statistics);
+
+#endif
\ No newline at end of file
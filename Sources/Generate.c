@@ -0,0 +1,260 @@
+#include "Graph.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+/**
+ * Synthetic graph generator for the benchmark suite (make bench-suite). Writes
+ * a .mtx file in the format LoadMtxFile reads: "V V E", then one
+ * "source destination weight" line per edge, weights in 0.01 .. 1.00 so that
+ * both the additive (A) and the reliability (B) engine accept them. The same
+ * family, sizes and seed always give the same file.
+ * - er: Erdős–Rényi G(n, m), m uniform edges without self-loops
+ * - rmat: R-MAT power-law graph (a, b, c, d = 0.57, 0.19, 0.19, 0.05), vertex 1 the largest hub
+ * - grid: road-like 2D grid, each road between 4-neighbours kept in both
+ *   directions with the probability that gives about m edges (at most 4V)
+ * - dag: layered DAG, each edge from a vertex to one of the next layer
+ */
+
+// R-MAT quadrant probabilities (top-left, top-right, bottom-left; bottom-right is the rest)
+#define RMAT_A 0.57
+#define RMAT_B 0.19
+#define RMAT_C 0.19
+
+// Private Methods:
+/**
+ * @brief Next value of the splitmix64 generator
+ * ! Complexity: O(1)
+ * @param seed (advanced)
+ * @return uint64_t 
+ */
+static inline uint64_t NextRandom(uint64_t* seed)
+{
+    uint64_t value = (*seed += 0x9E3779B97F4A7C15ULL);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Uniform random integer in [0, bound)
+ * ! Complexity: O(1)
+ */
+static inline int RandomBelow(uint64_t* seed, const int bound)
+{
+    return (int) ((NextRandom(seed) >> 11) % (uint64_t) bound);
+}
+
+/**
+ * @brief Uniform random double in [0, 1)
+ * ! Complexity: O(1)
+ */
+static inline double RandomUnit(uint64_t* seed)
+{
+    return (NextRandom(seed) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief Random link weight, a multiple of 0.01 in 0.01 .. 1.00
+ * ! Complexity: O(1)
+ */
+static inline double RandomWeight(uint64_t* seed)
+{
+    return (1 + RandomBelow(seed, 100)) / 100.0;
+}
+
+/**
+ * @brief Append m edges between uniformly random distinct vertices
+ * ! Complexity: O(m)
+ */
+static void GenerateErdosRenyi(struct EdgeList* edgeList, const int numberOfVertices, const long long numberOfEdges, uint64_t* seed)
+{
+    for (long long edge = 0 ; edge < numberOfEdges ; edge++)
+    {
+        const int srcId = 1 + RandomBelow(seed, numberOfVertices);
+        int dstId = 1 + RandomBelow(seed, numberOfVertices - 1);
+        if (dstId >= srcId)
+            dstId ++;
+        AddEdgeToEdgeList(edgeList, srcId, dstId, RandomWeight(seed));
+    }
+}
+
+/**
+ * @brief Append m R-MAT edges: each picks one quadrant of the adjacency matrix per bit of the ids
+ * ! Complexity: O(m lgV) expected
+ */
+static void GenerateRmat(struct EdgeList* edgeList, const int numberOfVertices, const long long numberOfEdges, uint64_t* seed)
+{
+    int scale = 0;
+    while ((1LL << scale) < numberOfVertices)
+        scale ++;
+    // Edges that fall outside the vertices or on the diagonal are drawn again
+    while (edgeList -> numberOfEdges < numberOfEdges)
+    {
+        int srcIndex = 0, dstIndex = 0;
+        for (int bit = scale - 1 ; bit >= 0 ; bit--)
+        {
+            const double quadrant = RandomUnit(seed);
+            if (quadrant >= RMAT_A + RMAT_B + RMAT_C)
+            {
+                srcIndex |= 1 << bit;
+                dstIndex |= 1 << bit;
+            }
+            else if (quadrant >= RMAT_A + RMAT_B)
+                srcIndex |= 1 << bit;
+            else if (quadrant >= RMAT_A)
+                dstIndex |= 1 << bit;
+        }
+        if (srcIndex >= numberOfVertices || dstIndex >= numberOfVertices || srcIndex == dstIndex)
+            continue;
+        AddEdgeToEdgeList(edgeList, srcIndex + 1, dstIndex + 1, RandomWeight(seed));
+    }
+}
+
+/**
+ * @brief Append the kept roads of a near-square grid, both directions with the same weight
+ * ! Complexity: O(V)
+ */
+static void GenerateGrid(struct EdgeList* edgeList, const int numberOfVertices, const long long numberOfEdges, uint64_t* seed)
+{
+    // Vertices fill the rows of a near-square grid; the last row may be partial
+    const int numberOfColumns = (int) ceil(sqrt((double) numberOfVertices));
+    long long numberOfRoads = 0;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        numberOfRoads += (index % numberOfColumns + 1 < numberOfColumns && index + 1 < numberOfVertices) + (index + numberOfColumns < numberOfVertices);
+    const double keepProbability = numberOfRoads > 0 ? fmin(1.0, numberOfEdges / (2.0 * numberOfRoads)) : 0.0;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        const int neighbours[2] = {index % numberOfColumns + 1 < numberOfColumns && index + 1 < numberOfVertices ? index + 1 : -1, index + numberOfColumns < numberOfVertices ? index + numberOfColumns : -1};
+        for (int direction = 0 ; direction < 2 ; direction++)
+        {
+            if (neighbours[direction] == -1 || RandomUnit(seed) >= keepProbability)
+                continue;
+            const double weight = RandomWeight(seed);
+            AddEdgeToEdgeList(edgeList, index + 1, neighbours[direction] + 1, weight);
+            AddEdgeToEdgeList(edgeList, neighbours[direction] + 1, index + 1, weight);
+        }
+    }
+}
+
+/**
+ * @brief First vertex index of a layer of the dag
+ * ! Complexity: O(1)
+ */
+static inline int LayerStart(const int layer, const int numberOfVertices, const int numberOfLayers)
+{
+    return (int) ((long long) layer * numberOfVertices / numberOfLayers);
+}
+
+/**
+ * @brief Append m edges, each from a random vertex outside the last layer to a random vertex of the next layer
+ * (none if there is a single layer)
+ * ! Complexity: O(m)
+ */
+static void GenerateLayeredDag(struct EdgeList* edgeList, const int numberOfVertices, const long long numberOfEdges, int numberOfLayers, uint64_t* seed)
+{
+    if (numberOfLayers <= 0)
+        numberOfLayers = (int) fmax(2.0, round(sqrt((double) numberOfVertices)));
+    if (numberOfLayers > numberOfVertices)
+        numberOfLayers = numberOfVertices;
+    // Layer l holds the vertex indices [LayerStart(l), LayerStart(l + 1)); edges leave every layer but the last
+    const int numberOfSources = LayerStart(numberOfLayers - 1, numberOfVertices, numberOfLayers);
+    if (numberOfSources == 0)
+        return;
+    for (long long edge = 0 ; edge < numberOfEdges ; edge++)
+    {
+        const int srcIndex = RandomBelow(seed, numberOfSources);
+        int layer = (int) ((long long) srcIndex * numberOfLayers / numberOfVertices);
+        while (LayerStart(layer + 1, numberOfVertices, numberOfLayers) <= srcIndex)
+            layer ++;
+        const int first = LayerStart(layer + 1, numberOfVertices, numberOfLayers);
+        const int last = LayerStart(layer + 2, numberOfVertices, numberOfLayers);
+        AddEdgeToEdgeList(edgeList, srcIndex + 1, first + RandomBelow(seed, last - first) + 1, RandomWeight(seed));
+    }
+}
+
+/**
+ * @brief Main Method
+ * ! Complexity: O(V + E)
+ * @param argc 
+ * @param argv 
+ * @return int 
+ */
+int main(int argc, char* argv[])
+{
+    // Options: -n <vertices> (default 100000), -m <edges> (default 8 per vertex),
+    // -s <seed> (default 1), -l <layers> of the dag (default sqrt(V))
+    int numberOfVertices = 100000, numberOfLayers = 0, option;
+    long long numberOfEdges = -1;
+    uint64_t seed = 1;
+    while ((option = getopt(argc, argv, "n:m:s:l:")) != -1)
+    {
+        switch (option)
+        {
+            case 'n':
+                numberOfVertices = atoi(optarg);
+                break;
+            case 'm':
+                numberOfEdges = atoll(optarg);
+                break;
+            case 's':
+                seed = strtoull(optarg, NULL, 10);
+                break;
+            case 'l':
+                numberOfLayers = atoi(optarg);
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-n vertices] [-m edges] [-s seed] [-l layers] er|rmat|grid|dag <file.mtx>\n", argv[0]);
+                exit(-1);
+        }
+    }
+    if (argc - optind != 2)
+    {
+        fprintf(stderr, "Usage: %s [-n vertices] [-m edges] [-s seed] [-l layers] er|rmat|grid|dag <file.mtx>\n", argv[0]);
+        exit(-1);
+    }
+    if (numberOfEdges < 0)
+        numberOfEdges = 8LL * numberOfVertices;
+    if (numberOfVertices < 2 || numberOfEdges > INT_MAX)
+    {
+        fprintf(stderr, "Graphs need at least 2 vertices and at most %d edges\n", INT_MAX);
+        exit(-1);
+    }
+    if (numberOfLayers == 1)
+    {
+        fprintf(stderr, "A dag needs at least 2 layers\n");
+        exit(-1);
+    }
+    const char* family = argv[optind];
+    const char* fileName = argv[optind + 1];
+    struct EdgeList* edgeList = CreateEdgeList((int) numberOfEdges);
+    if (strcmp(family, "er") == 0)
+        GenerateErdosRenyi(edgeList, numberOfVertices, numberOfEdges, &seed);
+    else if (strcmp(family, "rmat") == 0)
+        GenerateRmat(edgeList, numberOfVertices, numberOfEdges, &seed);
+    else if (strcmp(family, "grid") == 0)
+        GenerateGrid(edgeList, numberOfVertices, numberOfEdges, &seed);
+    else if (strcmp(family, "dag") == 0)
+        GenerateLayeredDag(edgeList, numberOfVertices, numberOfEdges, numberOfLayers, &seed);
+    else
+    {
+        fprintf(stderr, "Unknown graph family %s (er, rmat, grid, dag)\n", family);
+        exit(-1);
+    }
+    FILE* file = fopen(fileName, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open file %s\n", fileName);
+        exit(-1);
+    }
+    fprintf(file, "%d %d %d\n", numberOfVertices, numberOfVertices, edgeList -> numberOfEdges);
+    for (int edge = 0 ; edge < edgeList -> numberOfEdges ; edge++)
+        fprintf(file, "%d %d %.2lf\n", edgeList -> srcIds[edge], edgeList -> dstIds[edge], edgeList -> linkWeights[edge]);
+    fclose(file);
+    fprintf(stderr, "Wrote %s: %s graph, %d vertices, %d edges\n", fileName, family, numberOfVertices, edgeList -> numberOfEdges);
+    DestroyEdgeList(edgeList);
+    return 0;
+}
\ No newline at end of file
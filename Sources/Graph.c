@@ -0,0 +1,404 @@
+#include "Graph.h"
+#include "Search.h"
+#include "ThreadPool.h"
+#include "Arena.h"
+#include <sys/mman.h>
+#include <string.h>
+
+// Public Methods:
+/**
+ * @brief Create an EdgeList object
+ * ! Complexity: O(1)
+ * @param capacity 
+ * @return struct EdgeList* 
+ */
+struct EdgeList* CreateEdgeList(const int capacity)
+{
+    struct EdgeList* edgeList = (struct EdgeList*) malloc(sizeof(struct EdgeList));
+    edgeList -> numberOfEdges = 0;
+    edgeList -> capacity = capacity > 0 ? capacity : 1;
+    edgeList -> srcIds = (int*) malloc(edgeList -> capacity * sizeof(int));
+    edgeList -> dstIds = (int*) malloc(edgeList -> capacity * sizeof(int));
+    edgeList -> linkWeights = (double*) malloc(edgeList -> capacity * sizeof(double));
+    return edgeList;
+}
+
+/**
+ * @brief Append an Edge to an EdgeList Object, growing it if it is full
+ * ! Complexity: O(1) amortized
+ * @param edgeList 
+ * @param srcId 
+ * @param dstId 
+ * @param linkWeight 
+ */
+void AddEdgeToEdgeList(struct EdgeList* edgeList, const int srcId, const int dstId, const double linkWeight)
+{
+    if (edgeList -> numberOfEdges == edgeList -> capacity)
+    {
+        edgeList -> capacity *= 2;
+        edgeList -> srcIds = (int*) realloc(edgeList -> srcIds, edgeList -> capacity * sizeof(int));
+        edgeList -> dstIds = (int*) realloc(edgeList -> dstIds, edgeList -> capacity * sizeof(int));
+        edgeList -> linkWeights = (double*) realloc(edgeList -> linkWeights, edgeList -> capacity * sizeof(double));
+    }
+    edgeList -> srcIds[edgeList -> numberOfEdges] = srcId;
+    edgeList -> dstIds[edgeList -> numberOfEdges] = dstId;
+    edgeList -> linkWeights[edgeList -> numberOfEdges] = linkWeight;
+    edgeList -> numberOfEdges ++;
+}
+
+/**
+ * @brief Deallocate and Destroy an EdgeList Object
+ * ! Complexity: O(1)
+ * @param edgeList 
+ */
+void DestroyEdgeList(struct EdgeList* edgeList)
+{
+    free(edgeList -> srcIds);
+    free(edgeList -> dstIds);
+    free(edgeList -> linkWeights);
+    free(edgeList);
+}
+
+/**
+ * @brief Give a Graph new offset, target and weight arrays sized for its numberOfVertices
+ * and numberOfEdges, all three from one new arena of exactly their size. The arrays and
+ * arena it had before are left to the caller, who may still need them to fill the new ones.
+ * ! Complexity: O(1)
+ * @param graph 
+ */
+void AllocateGraphArrays(struct Graph* graph)
+{
+    const size_t offsetBytes = (graph -> numberOfVertices + 1) * sizeof(int);
+    const size_t numberOfSlots = graph -> numberOfEdges > 0 ? graph -> numberOfEdges : 1;
+    graph -> arena = CreateArena(ARENA_BYTES(offsetBytes) + ARENA_BYTES(numberOfSlots * sizeof(int)) + ARENA_BYTES(numberOfSlots * sizeof(double)));
+    graph -> edgeOffsets = (int*) ArenaAllocate(graph -> arena, offsetBytes);
+    graph -> edgeTargets = (int*) ArenaAllocate(graph -> arena, numberOfSlots * sizeof(int));
+    graph -> edgeWeights = (double*) ArenaAllocate(graph -> arena, numberOfSlots * sizeof(double));
+}
+
+/**
+ * @brief Create a CSR Graph object from an edge list in two passes
+ * (count out-degrees, then scatter edges into place)
+ * ! Complexity: O(V + E)
+ * @param numberOfVertices 
+ * @param edgeList 
+ * @param scratch arena for the temporary arrays, released before returning
+ * @return struct Graph* 
+ */
+struct Graph* CreateGraph(const int numberOfVertices, const struct EdgeList* edgeList, struct Arena* scratch)
+{
+    const int numberOfEdges = edgeList -> numberOfEdges;
+    struct Graph* graph = (struct Graph*) malloc(sizeof(struct Graph));
+    graph -> numberOfVertices = numberOfVertices;
+    graph -> numberOfEdges = numberOfEdges;
+    graph -> mapping = NULL;
+    graph -> mappingBytes = 0;
+    AllocateGraphArrays(graph);
+
+    // Pass 1: Count out-degrees and turn them into offsets
+    memset(graph -> edgeOffsets, 0, (numberOfVertices + 1) * sizeof(int));
+    for (int edge = 0 ; edge < numberOfEdges ; edge++)
+    {
+        int srcId = edgeList -> srcIds[edge];
+        int dstId = edgeList -> dstIds[edge];
+        if (srcId < 1 || srcId > numberOfVertices || dstId < 1 || dstId > numberOfVertices)
+        {
+            fprintf(stderr, "Edge %d -> %d is out of range for a graph of %d vertices\n", srcId, dstId, numberOfVertices);
+            exit(-1);
+        }
+        graph -> edgeOffsets[srcId] ++;
+    }
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        graph -> edgeOffsets[index + 1] += graph -> edgeOffsets[index];
+
+    // Pass 2: Scatter edges. Walking the input backwards keeps the per-vertex
+    // edge order of the former linked lists (last added edge first).
+    const struct ArenaMark mark = ArenaGetMark(scratch);
+    int* cursor = (int*) ArenaAllocate(scratch, numberOfVertices * sizeof(int));
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        cursor[index] = graph -> edgeOffsets[index];
+    for (int edge = numberOfEdges - 1 ; edge >= 0 ; edge--)
+    {
+        int position = cursor[edgeList -> srcIds[edge] - 1] ++;
+        graph -> edgeTargets[position] = edgeList -> dstIds[edge];
+        graph -> edgeWeights[position] = edgeList -> linkWeights[edge];
+    }
+    ArenaRelease(scratch, mark);
+
+    return graph;
+}
+
+/**
+ * Shared state of the parallel CSR build. Edges are first partitioned by the
+ * owner of their source vertex (each thread owns a contiguous vertex range),
+ * keeping file order inside each partition, then every owner builds its own
+ * slice of the offsets and edge arrays. The result is identical to CreateGraph.
+ */
+struct ParallelBuild {
+    int numberOfVertices;
+    int numberOfParts;
+    struct EdgeList* const* edgeLists;
+    int* partCounts;
+    int* partCursors;
+    int* ownerStarts;
+    int* srcIds;
+    int* dstIds;
+    double* linkWeights;
+    int* cursor;
+    struct Graph* graph;
+};
+
+static inline int FirstVertexOfOwner(const struct ParallelBuild* build, const int owner)
+{
+    return (int) (((long long) owner * build -> numberOfVertices + build -> numberOfParts - 1) / build -> numberOfParts);
+}
+
+static inline int OwnerOfVertex(const struct ParallelBuild* build, const int vertexId)
+{
+    return (int) ((long long) (vertexId - 1) * build -> numberOfParts / build -> numberOfVertices);
+}
+
+static void CountPartitionsTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    struct ParallelBuild* build = (struct ParallelBuild*) context;
+    for (int list = threadIndex ; list < build -> numberOfParts ; list += numberOfThreads)
+    {
+        const struct EdgeList* edgeList = build -> edgeLists[list];
+        int* counts = build -> partCounts + (long long) list * build -> numberOfParts;
+        for (int edge = 0 ; edge < edgeList -> numberOfEdges ; edge++)
+        {
+            int srcId = edgeList -> srcIds[edge];
+            int dstId = edgeList -> dstIds[edge];
+            if (srcId < 1 || srcId > build -> numberOfVertices || dstId < 1 || dstId > build -> numberOfVertices)
+            {
+                fprintf(stderr, "Edge %d -> %d is out of range for a graph of %d vertices\n", srcId, dstId, build -> numberOfVertices);
+                exit(-1);
+            }
+            counts[OwnerOfVertex(build, srcId)]++;
+        }
+    }
+}
+
+static void ScatterPartitionsTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    struct ParallelBuild* build = (struct ParallelBuild*) context;
+    for (int list = threadIndex ; list < build -> numberOfParts ; list += numberOfThreads)
+    {
+        const struct EdgeList* edgeList = build -> edgeLists[list];
+        int* cursors = build -> partCursors + (long long) list * build -> numberOfParts;
+        for (int edge = 0 ; edge < edgeList -> numberOfEdges ; edge++)
+        {
+            int position = cursors[OwnerOfVertex(build, edgeList -> srcIds[edge])]++;
+            build -> srcIds[position] = edgeList -> srcIds[edge];
+            build -> dstIds[position] = edgeList -> dstIds[edge];
+            build -> linkWeights[position] = edgeList -> linkWeights[edge];
+        }
+    }
+}
+
+static void BuildOwnedVerticesTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    struct ParallelBuild* build = (struct ParallelBuild*) context;
+    struct Graph* graph = build -> graph;
+    for (int owner = threadIndex ; owner < build -> numberOfParts ; owner += numberOfThreads)
+    {
+        const int firstVertex = FirstVertexOfOwner(build, owner);
+        const int lastVertex = FirstVertexOfOwner(build, owner + 1);
+        const int regionStart = build -> ownerStarts[owner];
+        const int regionEnd = build -> ownerStarts[owner + 1];
+
+        // Count out-degrees of the owned vertices and turn them into offsets
+        for (int index = firstVertex ; index < lastVertex ; index++)
+            graph -> edgeOffsets[index + 1] = 0;
+        for (int edge = regionStart ; edge < regionEnd ; edge++)
+            graph -> edgeOffsets[build -> srcIds[edge]] ++;
+        int running = regionStart;
+        for (int index = firstVertex ; index < lastVertex ; index++)
+        {
+            build -> cursor[index] = running;
+            running += graph -> edgeOffsets[index + 1];
+            graph -> edgeOffsets[index + 1] = running;
+        }
+
+        // Scatter backwards, exactly like CreateGraph
+        for (int edge = regionEnd - 1 ; edge >= regionStart ; edge--)
+        {
+            int position = build -> cursor[build -> srcIds[edge] - 1] ++;
+            graph -> edgeTargets[position] = build -> dstIds[edge];
+            graph -> edgeWeights[position] = build -> linkWeights[edge];
+        }
+    }
+}
+
+/**
+ * @brief Create a CSR Graph object in parallel from edge lists that together hold the edges in input order
+ * ! Complexity: O(V + E) work, O((V + E) / threads) time
+ * @param numberOfVertices 
+ * @param edgeLists 
+ * @param numberOfEdgeLists 
+ * @param pool 
+ * @param scratch arena for the temporary arrays, released before returning
+ * @return struct Graph* 
+ */
+struct Graph* CreateGraphFromEdgeLists(const int numberOfVertices, struct EdgeList* const* edgeLists, const int numberOfEdgeLists, struct ThreadPool* pool, struct Arena* scratch)
+{
+    if (numberOfEdgeLists == 1)
+        return CreateGraph(numberOfVertices, edgeLists[0], scratch);
+    const struct ArenaMark mark = ArenaGetMark(scratch);
+    struct ParallelBuild build;
+    const int numberOfParts = numberOfEdgeLists;
+    build.numberOfVertices = numberOfVertices;
+    build.numberOfParts = numberOfParts;
+    build.edgeLists = edgeLists;
+    build.partCounts = (int*) ArenaAllocateZeroed(scratch, (size_t) numberOfParts * numberOfParts * sizeof(int));
+    build.partCursors = (int*) ArenaAllocate(scratch, (size_t) numberOfParts * numberOfParts * sizeof(int));
+    build.ownerStarts = (int*) ArenaAllocate(scratch, (numberOfParts + 1) * sizeof(int));
+    RunInParallel(pool, CountPartitionsTask, &build);
+
+    // Owner-major prefix sum: partition of owner o holds list 0's edges, then list 1's, ...
+    int numberOfEdges = 0;
+    for (int owner = 0 ; owner < numberOfParts ; owner++)
+    {
+        build.ownerStarts[owner] = numberOfEdges;
+        for (int list = 0 ; list < numberOfParts ; list++)
+        {
+            build.partCursors[list * numberOfParts + owner] = numberOfEdges;
+            numberOfEdges += build.partCounts[list * numberOfParts + owner];
+        }
+    }
+    build.ownerStarts[numberOfParts] = numberOfEdges;
+
+    const int capacity = numberOfEdges > 0 ? numberOfEdges : 1;
+    build.srcIds = (int*) ArenaAllocate(scratch, capacity * sizeof(int));
+    build.dstIds = (int*) ArenaAllocate(scratch, capacity * sizeof(int));
+    build.linkWeights = (double*) ArenaAllocate(scratch, capacity * sizeof(double));
+    RunInParallel(pool, ScatterPartitionsTask, &build);
+
+    struct Graph* graph = (struct Graph*) malloc(sizeof(struct Graph));
+    graph -> numberOfVertices = numberOfVertices;
+    graph -> numberOfEdges = numberOfEdges;
+    graph -> mapping = NULL;
+    graph -> mappingBytes = 0;
+    AllocateGraphArrays(graph);
+    graph -> edgeOffsets[0] = 0;
+    build.cursor = (int*) ArenaAllocate(scratch, numberOfVertices * sizeof(int));
+    build.graph = graph;
+    RunInParallel(pool, BuildOwnedVerticesTask, &build);
+    ArenaRelease(scratch, mark);
+    return graph;
+}
+
+/**
+ * @brief Create the reverse (transposed) Graph: vertex v gets an edge to u with weight w
+ * for every edge u -> v of the given graph, in increasing order of u
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @return struct Graph* 
+ */
+struct Graph* CreateReverseGraph(const struct Graph* graph)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    const int numberOfEdges = graph -> numberOfEdges;
+    struct Graph* reverseGraph = (struct Graph*) malloc(sizeof(struct Graph));
+    reverseGraph -> numberOfVertices = numberOfVertices;
+    reverseGraph -> numberOfEdges = numberOfEdges;
+    reverseGraph -> mapping = NULL;
+    reverseGraph -> mappingBytes = 0;
+    AllocateGraphArrays(reverseGraph);
+
+    // Count in-degrees and turn them into offsets
+    memset(reverseGraph -> edgeOffsets, 0, (numberOfVertices + 1) * sizeof(int));
+    for (int edge = 0 ; edge < numberOfEdges ; edge++)
+        reverseGraph -> edgeOffsets[graph -> edgeTargets[edge]] ++;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        reverseGraph -> edgeOffsets[index + 1] += reverseGraph -> edgeOffsets[index];
+
+    int* cursor = (int*) malloc(numberOfVertices * sizeof(int));
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        cursor[index] = reverseGraph -> edgeOffsets[index];
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        for (int edge = graph -> edgeOffsets[index] ; edge < graph -> edgeOffsets[index + 1] ; edge++)
+        {
+            int position = cursor[graph -> edgeTargets[edge] - 1] ++;
+            reverseGraph -> edgeTargets[position] = index + 1;
+            reverseGraph -> edgeWeights[position] = graph -> edgeWeights[edge];
+        }
+    }
+    free(cursor);
+    return reverseGraph;
+}
+
+/**
+ * @brief Print a Graph object, along with the search state of its vertices if one is given
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @param state 
+ */
+void PrintGraph(const struct Graph* graph, const struct SearchState* state)
+{
+    printf("\nGraph - Number of Vertices: %d\n", graph -> numberOfVertices);
+    for (int index = 0 ; index < graph -> numberOfVertices ; index++)
+    {
+        if (state != NULL)
+            printf("\nVertex %d, Weakness: %lf, Prev: %d, Heap Index: %d\n", index + 1, state -> weights[index], state -> previousVertexIds[index], state -> heapIndices[index]);
+        else
+            printf("\nVertex %d\n", index + 1);
+        for (int edge = graph -> edgeOffsets[index] ; edge < graph -> edgeOffsets[index + 1] ; edge++)
+        {
+            printf("%d -> %d Link Weakness: %lf\n", index + 1, graph -> edgeTargets[edge], graph -> edgeWeights[edge]);
+        }
+    }
+}
+
+
+/**
+ * @brief Give a Graph mapped from a snapshot its own copy of the arrays so that they can
+ * be changed; a Graph that already owns its arrays is left as it is
+ * ! Complexity: O(V + E) for a mapped graph, O(1) otherwise
+ * @param graph 
+ */
+void MakeGraphWritable(struct Graph* graph)
+{
+    if (graph -> mapping == NULL)
+        return;
+    const int* edgeOffsets = graph -> edgeOffsets;
+    const int* edgeTargets = graph -> edgeTargets;
+    const double* edgeWeights = graph -> edgeWeights;
+    AllocateGraphArrays(graph);
+    memcpy(graph -> edgeOffsets, edgeOffsets, (graph -> numberOfVertices + 1) * sizeof(int));
+    memcpy(graph -> edgeTargets, edgeTargets, graph -> numberOfEdges * sizeof(int));
+    memcpy(graph -> edgeWeights, edgeWeights, graph -> numberOfEdges * sizeof(double));
+    munmap(graph -> mapping, graph -> mappingBytes);
+    graph -> mapping = NULL;
+    graph -> mappingBytes = 0;
+}
+
+/**
+ * @brief Bytes of the CSR arrays of a Graph
+ * ! Complexity: O(1)
+ * @param graph 
+ * @return size_t 
+ */
+size_t GetGraphBytes(const struct Graph* graph)
+{
+    return (graph -> numberOfVertices + 1) * sizeof(int) + (size_t) graph -> numberOfEdges * (sizeof(int) + sizeof(double));
+}
+
+/**
+ * @brief Deallocate and Destroy a Graph Object: one arena block, or one unmapping if it was
+ * loaded from a snapshot
+ * ! Complexity: O(1)
+ * @param graph 
+ */
+void DestroyGraph(struct Graph* graph)
+{
+    if (graph -> mapping != NULL)
+        munmap(graph -> mapping, graph -> mappingBytes);
+    else
+        DestroyArena(graph -> arena);
+    free(graph);
+}
+
+
+// Private Methods:
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef __GRAPH_H__
+#define __GRAPH_H__
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <float.h>
+
+struct EdgeList {
+    int numberOfEdges;
+    int capacity;
+    int* srcIds;
+    int* dstIds;
+    double* linkWeights;
+};
+
+struct SearchState;
+struct ThreadPool;
+struct Arena;
+
+/**
+ * Compressed sparse row (CSR) layout: the out-edges of vertex v (1-based)
+ * are edgeTargets/edgeWeights[edgeOffsets[v - 1] .. edgeOffsets[v] - 1].
+ * A Graph is read-only once built, except where MakeGraphWritable gives it
+ * its own arrays first (edge updates, log-space weights); per-query data
+ * lives in a SearchState.
+ * The three arrays are carved out of one arena, so a graph is released with a
+ * single block; when loaded from a snapshot they point into a read-only
+ * mapping instead and arena is NULL.
+ */
+struct Graph {
+    int numberOfVertices;
+    int numberOfEdges;
+    int* edgeOffsets;
+    int* edgeTargets;
+    double* edgeWeights;
+    struct Arena* arena;
+    void* mapping;
+    size_t mappingBytes;
+};
+
+// Public Methods:
+struct EdgeList* CreateEdgeList(const int capacity);
+
+void AddEdgeToEdgeList(struct EdgeList* edgeList, const int srcId, const int dstId, const double linkWeight);
+
+void DestroyEdgeList(struct EdgeList* edgeList);
+
+void AllocateGraphArrays(struct Graph* graph);
+
+struct Graph* CreateGraph(const int numberOfVertices, const struct EdgeList* edgeList, struct Arena* scratch);
+
+struct Graph* CreateGraphFromEdgeLists(const int numberOfVertices, struct EdgeList* const* edgeLists, const int numberOfEdgeLists, struct ThreadPool* pool, struct Arena* scratch);
+
+struct Graph* CreateReverseGraph(const struct Graph* graph);
+
+void PrintGraph(const struct Graph* graph, const struct SearchState* state);
+
+void MakeGraphWritable(struct Graph* graph);
+
+size_t GetGraphBytes(const struct Graph* graph);
+
+void DestroyGraph(struct Graph* graph);
+// Private Methods:
+
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,4 @@
+#ifndef __HELPER_H__
+#define __HELPER_H__
+#define SINGLE_STEPPING (0 == 1)
+#endif
\ No newline at end of file
@@ -1,5 +0,0 @@
-#ifndef __HELPERA_H__
-#define __HELPERA_H__
-#define SINGLE_STEPPING (0 == 1)
-#define IS_MIN (0 == 0)
-#endif
\ No newline at end of file
@@ -1,5 +0,0 @@
-#ifndef __HELPERB_H__
-#define __HELPERB_H__
-#define SINGLE_STEPPING (0 == 1)
-#define IS_MIN (0 == 1)
-#endif
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "Instrument.h"
+#include "Timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+__thread struct InstrumentCounters instrumentCounters;
+
+// Private Methods:
+/**
+ * @brief Write a string as a JSON string literal, escaping quotes, backslashes and control characters
+ * ! Complexity: O(length)
+ * @param file 
+ * @param text 
+ */
+static void WriteJsonString(FILE* file, const char* text)
+{
+    fputc('"', file);
+    for (const unsigned char* character = (const unsigned char*) text ; *character != '\0' ; character++)
+    {
+        if (*character == '"' || *character == '\\')
+            fprintf(file, "\\%c", *character);
+        else if (*character < 0x20)
+            fprintf(file, "\\u%04x", *character);
+        else
+            fputc(*character, file);
+    }
+    fputc('"', file);
+}
+
+// Public Methods:
+/**
+ * @brief End the running phase, if any, and start timing the named one
+ * ! Complexity: O(1)
+ * @param timer 
+ * @param name (not copied: a string literal or one that outlives the timer)
+ */
+void StartPhase(struct PhaseTimer* timer, const char* name)
+{
+    EndPhase(timer);
+    if (timer -> numberOfPhases == MAXIMUM_PHASES)
+    {
+        fprintf(stderr, "More than %d phases\n", MAXIMUM_PHASES);
+        exit(-1);
+    }
+    timer -> names[timer -> numberOfPhases] = name;
+    timer -> isRunning = true;
+    timer -> start = NowInMilliseconds();
+}
+
+/**
+ * @brief End the running phase, if any
+ * ! Complexity: O(1)
+ * @param timer 
+ */
+void EndPhase(struct PhaseTimer* timer)
+{
+    if (!timer -> isRunning)
+        return;
+    timer -> milliseconds[timer -> numberOfPhases ++] = NowInMilliseconds() - timer -> start;
+    timer -> isRunning = false;
+}
+
+/**
+ * @brief Write the phase times, the operation counters of this thread (null unless built
+ * with INSTRUMENTATION) and the peak resident memory of the process as one JSON object
+ * ! Complexity: O(phases)
+ * @param timer 
+ * @param fileName where the report goes, - for stdout
+ * @param graphName 
+ * @param metricName 
+ * @param queueName NULL for a search without a queue
+ * @param numberOfVertices 
+ * @param numberOfEdges 
+ */
+void WriteInstrumentReport(const struct PhaseTimer* timer, const char* fileName, const char* graphName, const char* metricName, const char* queueName, const int numberOfVertices, const int numberOfEdges)
+{
+    const bool isStdout = strcmp(fileName, "-") == 0;
+    FILE* file = isStdout ? stdout : fopen(fileName, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open report file %s\n", fileName);
+        exit(-1);
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    fprintf(file, "{\n  \"graph\": ");
+    WriteJsonString(file, graphName);
+    fprintf(file, ",\n  \"metric\": ");
+    WriteJsonString(file, metricName);
+    fprintf(file, ",\n  \"queue\": ");
+    if (queueName != NULL)
+        WriteJsonString(file, queueName);
+    else
+        fprintf(file, "null");
+    fprintf(file, ",\n  \"vertices\": %d,\n  \"edges\": %d,\n  \"phases\": [", numberOfVertices, numberOfEdges);
+    double totalMilliseconds = 0.0;
+    for (int phase = 0 ; phase < timer -> numberOfPhases ; phase++)
+    {
+        fprintf(file, "%s\n    {\"name\": ", phase > 0 ? "," : "");
+        WriteJsonString(file, timer -> names[phase]);
+        fprintf(file, ", \"ms\": %.3lf}", timer -> milliseconds[phase]);
+        totalMilliseconds += timer -> milliseconds[phase];
+    }
+    fprintf(file, "\n  ],\n  \"totalMs\": %.3lf,\n  \"counters\": ", totalMilliseconds);
+    if (INSTRUMENTED)
+    {
+        fprintf(file, "{\"extracts\": %lld, \"inserts\": %lld, \"decreaseKeys\": %lld, \"relaxations\": %lld, \"improvements\": %lld, \"siftSteps\": %lld}",
+            instrumentCounters.extracts, instrumentCounters.inserts, instrumentCounters.decreaseKeys,
+            instrumentCounters.relaxations, instrumentCounters.improvements, instrumentCounters.siftSteps);
+    }
+    else
+        fprintf(file, "null");
+    // Linux reports the peak resident set size in kilobytes
+    fprintf(file, ",\n  \"peakResidentBytes\": %lld\n}\n", (long long) usage.ru_maxrss * 1024);
+    if (isStdout)
+        fflush(file);
+    else
+        fclose(file);
+}
\ No newline at end of file
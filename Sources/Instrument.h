@@ -0,0 +1,57 @@
+#ifndef __INSTRUMENT_H__
+#define __INSTRUMENT_H__
+#include <stdbool.h>
+
+/**
+ * Operation counters of the search hot paths. They only exist in builds with
+ * INSTRUMENTATION defined (make instrumented); elsewhere INSTRUMENT_COUNT
+ * expands to nothing and the hot paths are exactly as without it. The
+ * counters are per thread: a report holds those of the thread writing it.
+ * - extracts, inserts, decreaseKeys: calls of the priority-queue interface
+ * - relaxations: edges scanned out of a settled vertex
+ * - improvements: relaxations that gave their target a better weight
+ * - siftSteps: elements the queue moved to restore its order: sift steps of
+ *   the binary and d-ary heaps, links of the pairing heap, bucket moves of
+ *   the radix heap
+ */
+#ifdef INSTRUMENTATION
+#define INSTRUMENTED (1 == 1)
+#define INSTRUMENT_COUNT(counter) (instrumentCounters.counter ++)
+#else
+#define INSTRUMENTED (0 == 1)
+#define INSTRUMENT_COUNT(counter) ((void) 0)
+#endif
+
+struct InstrumentCounters {
+    long long extracts;
+    long long inserts;
+    long long decreaseKeys;
+    long long relaxations;
+    long long improvements;
+    long long siftSteps;
+};
+
+extern __thread struct InstrumentCounters instrumentCounters;
+
+#define MAXIMUM_PHASES 16
+
+/**
+ * Wall time of consecutive phases of a run: starting a phase ends the one
+ * before it, so the phases tile the run from the first start to the end.
+ */
+struct PhaseTimer {
+    int numberOfPhases;
+    const char* names[MAXIMUM_PHASES];
+    double milliseconds[MAXIMUM_PHASES];
+    double start;
+    bool isRunning;
+};
+
+// Public Methods:
+void StartPhase(struct PhaseTimer* timer, const char* name);
+
+void EndPhase(struct PhaseTimer* timer);
+
+void WriteInstrumentReport(const struct PhaseTimer* timer, const char* fileName, const char* graphName, const char* metricName, const char* queueName, const int numberOfVertices, const int numberOfEdges);
+
+#endif
\ No newline at end of file
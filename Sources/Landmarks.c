@@ -0,0 +1,240 @@
+#include "Landmarks.h"
+#include "Snapshot.h"
+#include <string.h>
+
+/**
+ * Shared state of the parallel backward searches that fill toWeights:
+ * each task is one landmark, searched from over the reverse graph.
+ */
+struct LandmarkRun {
+    const struct Graph* reverseGraph;
+    const struct Metric* metric;
+    struct Landmarks* landmarks;
+    struct SearchState** states;
+    struct PriorityQueue** queues;
+};
+
+// Private Methods:
+static inline uint64_t AlignToWord(const uint64_t position)
+{
+    return (position + 7) / 8 * 8;
+}
+
+static struct Landmarks* CreateLandmarks(const int numberOfLandmarks, const int numberOfVertices)
+{
+    struct Landmarks* landmarks = (struct Landmarks*) malloc(sizeof(struct Landmarks));
+    landmarks -> numberOfLandmarks = numberOfLandmarks;
+    landmarks -> numberOfVertices = numberOfVertices;
+    landmarks -> landmarkIds = (int*) malloc(numberOfLandmarks * sizeof(int));
+    landmarks -> fromWeights = (double*) malloc((size_t) numberOfVertices * numberOfLandmarks * sizeof(double));
+    landmarks -> toWeights = (double*) malloc((size_t) numberOfVertices * numberOfLandmarks * sizeof(double));
+    return landmarks;
+}
+
+static struct PriorityQueue* CreateLandmarkQueue(const struct Metric* metric, const int numberOfVertices)
+{
+    return metric -> RunWithoutQueue != NULL ? NULL : CreatePriorityQueue(&BinaryHeapOperations, numberOfVertices);
+}
+
+static void ComputeToWeightsTask(void* context, const int taskIndex, const int threadIndex)
+{
+    struct LandmarkRun* run = (struct LandmarkRun*) context;
+    struct Landmarks* landmarks = run -> landmarks;
+    struct SearchState* state = run -> states[threadIndex];
+    ResetSearchState(state, landmarks -> landmarkIds[taskIndex]); // ! O(touched vertices)
+    RunMetricQuery(run -> metric, run -> reverseGraph, state, run -> queues[threadIndex], true, -1);
+    for (int index = 0 ; index < landmarks -> numberOfVertices ; index++)
+        landmarks -> toWeights[(size_t) index * landmarks -> numberOfLandmarks + taskIndex] = state -> weights[index];
+}
+
+static struct Landmarks* RejectLandmarks(const char* fileName, const char* reason, FILE* file, void* payload)
+{
+    fprintf(stderr, "Landmarks %s: %s, recomputing\n", fileName, reason);
+    fclose(file);
+    free(payload);
+    return NULL;
+}
+
+// Public Methods:
+/**
+ * @brief Choose landmarks by farthest-point selection and compute the best path weights
+ * from every landmark (over graph) and to it (over reverseGraph, one landmark per task).
+ * The first landmark is the vertex farthest from vertex 1; each next one is the vertex
+ * farthest from its nearest landmark so far, preferring vertices no landmark reaches.
+ * "Farther" means a worse weight, so this works for every metric.
+ * ! Complexity: O(k (V + E)lgV), the backward searches divided over the threads
+ * @param graph 
+ * @param reverseGraph 
+ * @param metric 
+ * @param numberOfLandmarks (at most V)
+ * @param pool 
+ * @return struct Landmarks* 
+ */
+struct Landmarks* SelectLandmarks(const struct Graph* graph, const struct Graph* reverseGraph, const struct Metric* metric, const int numberOfLandmarks, struct ThreadPool* pool)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    struct Landmarks* landmarks = CreateLandmarks(numberOfLandmarks, numberOfVertices);
+    // Whether a smaller weight is the better one, read off the metric's identity and unreachable weights
+    const bool isSmallerBetter = metric -> identity < metric -> unreachable;
+    struct SearchState* state = CreateSearchStateForMetric(metric, numberOfVertices);
+    struct PriorityQueue* queue = CreateLandmarkQueue(metric, numberOfVertices);
+    double* nearestWeights = (double*) malloc(numberOfVertices * sizeof(double));
+
+    ResetSearchState(state, 1);
+    RunMetricQuery(metric, graph, state, queue, true, -1); // ! O((V + E)lgV)
+    int landmarkId = 1;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        const double weight = state -> weights[index];
+        if (weight != metric -> unreachable && (isSmallerBetter ? weight > state -> weights[landmarkId - 1] : weight < state -> weights[landmarkId - 1]))
+            landmarkId = index + 1;
+        nearestWeights[index] = metric -> unreachable;
+    }
+    for (int landmark = 0 ; landmark < numberOfLandmarks ; landmark++)
+    {
+        landmarks -> landmarkIds[landmark] = landmarkId;
+        ResetSearchState(state, landmarkId); // ! O(touched vertices)
+        RunMetricQuery(metric, graph, state, queue, true, -1); // ! O((V + E)lgV)
+        for (int index = 0 ; index < numberOfVertices ; index++)
+        {
+            const double weight = state -> weights[index];
+            landmarks -> fromWeights[(size_t) index * numberOfLandmarks + landmark] = weight;
+            if (isSmallerBetter ? weight < nearestWeights[index] : weight > nearestWeights[index])
+                nearestWeights[index] = weight;
+        }
+        // Landmarks themselves have the identity weight, the nearest possible, so they are never picked again
+        landmarkId = 1;
+        for (int index = 1 ; index < numberOfVertices ; index++)
+        {
+            if (isSmallerBetter ? nearestWeights[index] > nearestWeights[landmarkId - 1] : nearestWeights[index] < nearestWeights[landmarkId - 1])
+                landmarkId = index + 1;
+        }
+    }
+    free(nearestWeights);
+    DestroySearchState(state);
+    if (queue != NULL)
+        DestroyPriorityQueue(queue);
+
+    struct LandmarkRun run = { reverseGraph, metric, landmarks, NULL, NULL };
+    run.states = (struct SearchState**) malloc(pool -> numberOfThreads * sizeof(struct SearchState*));
+    run.queues = (struct PriorityQueue**) malloc(pool -> numberOfThreads * sizeof(struct PriorityQueue*));
+    for (int thread = 0 ; thread < pool -> numberOfThreads ; thread++)
+    {
+        run.states[thread] = CreateSearchStateForMetric(metric, numberOfVertices);
+        run.queues[thread] = CreateLandmarkQueue(metric, numberOfVertices);
+    }
+    RunTasksWithStealing(pool, numberOfLandmarks, ComputeToWeightsTask, &run); // ! O(k (V + E)lgV / threads)
+    for (int thread = 0 ; thread < pool -> numberOfThreads ; thread++)
+    {
+        DestroySearchState(run.states[thread]);
+        if (run.queues[thread] != NULL)
+            DestroyPriorityQueue(run.queues[thread]);
+    }
+    free(run.states);
+    free(run.queues);
+    return landmarks;
+}
+
+/**
+ * @brief Write landmark tables to a sidecar file (via a temporary file and a rename).
+ * The file is only a cache, so a failure is returned rather than fatal.
+ * ! Complexity: O(V + E + kV)
+ * @param landmarks 
+ * @param graph 
+ * @param metric 
+ * @param fileName 
+ * @return true if the file was written
+ */
+bool WriteLandmarks(const struct Landmarks* landmarks, const struct Graph* graph, const struct Metric* metric, const char* fileName)
+{
+    struct LandmarksHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, LANDMARKS_MAGIC, sizeof(header.magic));
+    header.version = LANDMARKS_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    strncpy(header.metricName, metric -> name, sizeof(header.metricName) - 1);
+    header.numberOfVertices = graph -> numberOfVertices;
+    header.numberOfEdges = graph -> numberOfEdges;
+    header.numberOfLandmarks = landmarks -> numberOfLandmarks;
+    header.graphFingerprint = ComputeGraphFingerprint(graph);
+
+    const uint64_t idsBytes = AlignToWord(landmarks -> numberOfLandmarks * sizeof(int));
+    const uint64_t tableBytes = header.numberOfVertices * header.numberOfLandmarks * sizeof(double);
+    const uint64_t payloadBytes = idsBytes + 2 * tableBytes;
+    unsigned char* payload = (unsigned char*) calloc(payloadBytes, 1);
+    memcpy(payload, landmarks -> landmarkIds, landmarks -> numberOfLandmarks * sizeof(int));
+    memcpy(payload + idsBytes, landmarks -> fromWeights, tableBytes);
+    memcpy(payload + idsBytes + tableBytes, landmarks -> toWeights, tableBytes);
+    header.checksum = ComputeChecksum(payload, payloadBytes);
+
+    char* temporaryName = (char*) malloc(strlen(fileName) + 5);
+    sprintf(temporaryName, "%s.tmp", fileName);
+    FILE* file = fopen(temporaryName, "wb");
+    bool isWritten = false;
+    if (file != NULL)
+    {
+        isWritten = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(payload, payloadBytes, 1, file) == 1;
+        isWritten = fclose(file) == 0 && isWritten && rename(temporaryName, fileName) == 0;
+        if (!isWritten)
+            remove(temporaryName);
+    }
+    free(temporaryName);
+    free(payload);
+    return isWritten;
+}
+
+/**
+ * @brief Load landmark tables from a sidecar file. The file is only a cache: if it is
+ * missing, damaged, or was computed for another graph, metric or number of landmarks,
+ * NULL is returned and the caller recomputes it.
+ * ! Complexity: O(V + E + kV)
+ * @param fileName 
+ * @param graph 
+ * @param metric 
+ * @param numberOfLandmarks 
+ * @return struct Landmarks* (NULL if the file cannot be used)
+ */
+struct Landmarks* LoadLandmarks(const char* fileName, const struct Graph* graph, const struct Metric* metric, const int numberOfLandmarks)
+{
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL)
+        return NULL;
+    struct LandmarksHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, LANDMARKS_MAGIC, sizeof(header.magic)) != 0)
+        return RejectLandmarks(fileName, "Not a landmark file", file, NULL);
+    if (header.version != LANDMARKS_VERSION || header.byteOrder != SNAPSHOT_BYTE_ORDER)
+        return RejectLandmarks(fileName, "Unsupported version or byte order", file, NULL);
+    if (strncmp(header.metricName, metric -> name, sizeof(header.metricName)) != 0 || header.numberOfLandmarks != (uint64_t) numberOfLandmarks)
+        return RejectLandmarks(fileName, "Computed for another metric or number of landmarks", file, NULL);
+    if (header.numberOfVertices != (uint64_t) graph -> numberOfVertices || header.numberOfEdges != (uint64_t) graph -> numberOfEdges
+        || header.graphFingerprint != ComputeGraphFingerprint(graph))
+        return RejectLandmarks(fileName, "Computed for another graph", file, NULL);
+
+    const uint64_t idsBytes = AlignToWord(numberOfLandmarks * sizeof(int));
+    const uint64_t tableBytes = header.numberOfVertices * header.numberOfLandmarks * sizeof(double);
+    const uint64_t payloadBytes = idsBytes + 2 * tableBytes;
+    unsigned char* payload = (unsigned char*) malloc(payloadBytes);
+    if (fread(payload, payloadBytes, 1, file) != 1 || ComputeChecksum(payload, payloadBytes) != header.checksum)
+        return RejectLandmarks(fileName, "Checksum mismatch", file, payload);
+    fclose(file);
+
+    struct Landmarks* landmarks = CreateLandmarks(numberOfLandmarks, graph -> numberOfVertices);
+    memcpy(landmarks -> landmarkIds, payload, numberOfLandmarks * sizeof(int));
+    memcpy(landmarks -> fromWeights, payload + idsBytes, tableBytes);
+    memcpy(landmarks -> toWeights, payload + idsBytes + tableBytes, tableBytes);
+    free(payload);
+    return landmarks;
+}
+
+/**
+ * @brief Destroy a Landmarks object
+ * ! Complexity: O(1)
+ * @param landmarks 
+ */
+void DestroyLandmarks(struct Landmarks* landmarks)
+{
+    free(landmarks -> landmarkIds);
+    free(landmarks -> fromWeights);
+    free(landmarks -> toWeights);
+    free(landmarks);
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef __LANDMARKS_H__
+#define __LANDMARKS_H__
+#include "Dijkstra.h"
+#include "Graph.h"
+#include "ThreadPool.h"
+#include <stdint.h>
+
+#define LANDMARKS_MAGIC "DIJKALT"
+#define LANDMARKS_VERSION 1
+#define LANDMARKS_METRIC_NAME_BYTES 16
+
+/**
+ * ALT (A*, landmarks, triangle inequality) preprocessing: the weights of the
+ * best paths from and to a few landmark vertices. Both tables are stored
+ * vertex-major, so the numberOfLandmarks weights A* needs for one vertex
+ * share a cache line or two. Unreached entries hold the metric's
+ * unreachable weight.
+ */
+struct Landmarks {
+    int numberOfLandmarks;
+    int numberOfVertices;
+    int* landmarkIds;
+    double* fromWeights;    // [(v - 1) * numberOfLandmarks + l]: landmark l -> v
+    double* toWeights;      // [(v - 1) * numberOfLandmarks + l]: v -> landmark l
+};
+
+/**
+ * On-disk layout of a landmark sidecar file: this header, then landmarkIds
+ * (int32, padded to 8 bytes), fromWeights and toWeights (float64). The
+ * graph fingerprint ties the file to the exact graph and metric it was
+ * computed for; the checksum covers every byte after the header.
+ */
+struct LandmarksHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    char metricName[LANDMARKS_METRIC_NAME_BYTES];
+    uint64_t numberOfVertices;
+    uint64_t numberOfEdges;
+    uint64_t numberOfLandmarks;
+    uint64_t graphFingerprint;
+    uint64_t checksum;
+};
+
+// Public Methods:
+struct Landmarks* SelectLandmarks(const struct Graph* graph, const struct Graph* reverseGraph, const struct Metric* metric, const int numberOfLandmarks, struct ThreadPool* pool);
+
+bool WriteLandmarks(const struct Landmarks* landmarks, const struct Graph* graph, const struct Metric* metric, const char* fileName);
+
+struct Landmarks* LoadLandmarks(const char* fileName, const struct Graph* graph, const struct Metric* metric, const int numberOfLandmarks);
+
+void DestroyLandmarks(struct Landmarks* landmarks);
+
+#endif
\ No newline at end of file
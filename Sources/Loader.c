@@ -0,0 +1,343 @@
+#include "Loader.h"
+#include "Timer.h"
+#include "ThreadPool.h"
+#include "Arena.h"
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct Cursor {
+    const char* position;
+    const char* end;
+    const char* fileStart;
+};
+
+struct ParseChunks {
+    const char* fileStart;
+    const char** chunkStarts;
+    struct EdgeList** edgeLists;
+    int numberOfChunks;
+    long long numberOfVertices;
+};
+
+// Edge lines are only split across threads in chunks of at least this size
+#ifndef MINIMUM_CHUNK_BYTES
+#define MINIMUM_CHUNK_BYTES (1 << 20)
+#endif
+// Block size of the scratch arena; the edge-sized build arrays get blocks of their own
+#define SCRATCH_BLOCK_BYTES (1 << 16)
+
+// Exact powers of ten: a mantissa below 2^53 divided or multiplied by one of
+// these is correctly rounded, which is what strtod would return.
+static const double POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Private Methods:
+static void ParseError(const struct Cursor* cursor, const char* message)
+{
+    // Only reached on bad input, so the line number is recovered by counting
+    int lineNumber = 1;
+    for (const char* position = cursor -> fileStart ; position < cursor -> position ; position++)
+        lineNumber += *position == '\n';
+    fprintf(stderr, "Line %d: %s\n", lineNumber, message);
+    exit(-1);
+}
+
+static inline void SkipBlanks(struct Cursor* cursor)
+{
+    while (cursor -> position < cursor -> end && (*cursor -> position == ' ' || *cursor -> position == '\t' || *cursor -> position == '\r'))
+        cursor -> position++;
+}
+
+/**
+ * @brief Move to the start of the next line holding data, skipping '%' comments and blank lines
+ * ! Complexity: O(skipped bytes)
+ * @param cursor 
+ * @return bool false at the end of the file
+ */
+static bool NextDataLine(struct Cursor* cursor)
+{
+    while (cursor -> position < cursor -> end)
+    {
+        SkipBlanks(cursor);
+        if (cursor -> position < cursor -> end && *cursor -> position != '%' && *cursor -> position != '\n')
+            return true;
+        const char* newline = memchr(cursor -> position, '\n', cursor -> end - cursor -> position);
+        cursor -> position = newline != NULL ? newline + 1 : cursor -> end;
+    }
+    return false;
+}
+
+static void FinishLine(struct Cursor* cursor)
+{
+    SkipBlanks(cursor);
+    if (cursor -> position < cursor -> end)
+    {
+        if (*cursor -> position != '\n')
+            ParseError(cursor, "Unexpected characters at the end of the line");
+        cursor -> position++;
+    }
+}
+
+static inline bool HasField(struct Cursor* cursor)
+{
+    SkipBlanks(cursor);
+    return cursor -> position < cursor -> end && *cursor -> position != '\n';
+}
+
+static inline long long ParseInteger(struct Cursor* cursor)
+{
+    SkipBlanks(cursor);
+    const char* position = cursor -> position;
+    bool isNegative = false;
+    if (position < cursor -> end && (*position == '-' || *position == '+'))
+        isNegative = *position++ == '-';
+    const char* digits = position;
+    long long value = 0;
+    while (position < cursor -> end && (unsigned) (*position - '0') < 10 && value < INT_MAX)
+        value = value * 10 + (*position++ - '0');
+    if (position == digits)
+        ParseError(cursor, "Expected an integer");
+    cursor -> position = position;
+    return isNegative ? -value : value;
+}
+
+/**
+ * @brief Parse a decimal number without going through the C locale.
+ * Mantissas of up to 19 digits with small exponents (every weight in our inputs)
+ * take the exact fast path; anything else falls back to strtod.
+ * ! Complexity: O(length)
+ * @param cursor 
+ * @return double 
+ */
+static inline double ParseDouble(struct Cursor* cursor)
+{
+    SkipBlanks(cursor);
+    const char* start = cursor -> position;
+    const char* position = start;
+    bool isNegative = false;
+    if (position < cursor -> end && (*position == '-' || *position == '+'))
+        isNegative = *position++ == '-';
+    uint64_t mantissa = 0;
+    int numberOfDigits = 0, exponent = 0;
+    bool hasDigits = false;
+    while (position < cursor -> end && (unsigned) (*position - '0') < 10)
+    {
+        if (numberOfDigits < 19)
+        {
+            mantissa = mantissa * 10 + (*position - '0');
+            if (mantissa != 0)
+                numberOfDigits++;
+        }
+        else
+            exponent++;
+        position++;
+        hasDigits = true;
+    }
+    if (position < cursor -> end && *position == '.')
+    {
+        position++;
+        while (position < cursor -> end && (unsigned) (*position - '0') < 10)
+        {
+            if (numberOfDigits < 19)
+            {
+                mantissa = mantissa * 10 + (*position - '0');
+                if (mantissa != 0)
+                    numberOfDigits++;
+                exponent--;
+            }
+            position++;
+            hasDigits = true;
+        }
+    }
+    if (!hasDigits)
+        ParseError(cursor, "Expected a number");
+    if (position < cursor -> end && (*position == 'e' || *position == 'E'))
+    {
+        position++;
+        bool isExponentNegative = false;
+        if (position < cursor -> end && (*position == '-' || *position == '+'))
+            isExponentNegative = *position++ == '-';
+        int explicitExponent = 0;
+        while (position < cursor -> end && (unsigned) (*position - '0') < 10)
+        {
+            if (explicitExponent < 100000)
+                explicitExponent = explicitExponent * 10 + (*position - '0');
+            position++;
+        }
+        exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+    }
+    cursor -> position = position;
+
+    double value;
+    if (mantissa < ((uint64_t) 1 << 53) && exponent >= -22 && exponent <= 22)
+    {
+        value = (double) mantissa;
+        value = exponent < 0 ? value / POWERS_OF_TEN[-exponent] : value * POWERS_OF_TEN[exponent];
+    }
+    else
+    {
+        // Truncating a longer token would parse it to another value
+        char buffer[128];
+        const size_t length = position - start;
+        if (length >= sizeof(buffer))
+            ParseError(cursor, "Number is too long");
+        memcpy(buffer, start, length);
+        buffer[length] = '\0';
+        return strtod(buffer, NULL);
+    }
+    return isNegative ? -value : value;
+}
+
+/**
+ * @brief Parse the edge lines of one newline-aligned chunk into its own edge list
+ * ! Complexity: O(chunk bytes)
+ */
+static void ParseChunkTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    struct ParseChunks* chunks = (struct ParseChunks*) context;
+    for (int chunk = threadIndex ; chunk < chunks -> numberOfChunks ; chunk += numberOfThreads)
+    {
+        struct Cursor cursor = { chunks -> chunkStarts[chunk], chunks -> chunkStarts[chunk + 1], chunks -> fileStart };
+        struct EdgeList* edgeList = chunks -> edgeLists[chunk];
+        const long long numberOfVertices = chunks -> numberOfVertices;
+        while (NextDataLine(&cursor))
+        {
+            const long long srcId = ParseInteger(&cursor);
+            const long long dstId = ParseInteger(&cursor);
+            if (srcId < 1 || srcId > numberOfVertices || dstId < 1 || dstId > numberOfVertices)
+                ParseError(&cursor, "Vertex id out of range");
+            const double linkWeight = HasField(&cursor) ? ParseDouble(&cursor) : 1.0;
+            FinishLine(&cursor);
+            AddEdgeToEdgeList(edgeList, (int) srcId, (int) dstId, linkWeight);
+        }
+    }
+}
+
+// Public Methods:
+/**
+ * @brief Load a Matrix Market (.mtx) file into a Graph by memory-mapping it and
+ * parsing the mapped bytes in place. Lines starting with '%' are comments, the
+ * first data line is "rows columns entries" and every further line is
+ * "source destination weight" (weight 1 if a pattern file leaves it out).
+ * The edge lines are split into newline-aligned chunks (about one per MB, at
+ * most one per thread) that the pool parses concurrently; the CSR arrays are
+ * then built in parallel. The graph does not depend on the number of threads.
+ * ! Complexity: O(V + E)
+ * @param fileName 
+ * @param pool 
+ * @param statistics (may be NULL)
+ * @return struct Graph* 
+ */
+struct Graph* LoadMtxFile(const char* fileName, struct ThreadPool* pool, struct LoadStatistics* statistics)
+{
+    const double start = NowInMilliseconds();
+    int descriptor = open(fileName, O_RDONLY);
+    if (descriptor == -1)
+    {
+        fprintf(stderr, "Cannot open file %s\n", fileName);
+        exit(-1);
+    }
+    struct stat fileStatus;
+    if (fstat(descriptor, &fileStatus) == -1)
+    {
+        fprintf(stderr, "Cannot read file %s\n", fileName);
+        exit(-1);
+    }
+    const size_t numberOfBytes = fileStatus.st_size;
+    const char* bytes = "";
+    if (numberOfBytes > 0)
+    {
+        bytes = (const char*) mmap(NULL, numberOfBytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (bytes == MAP_FAILED)
+        {
+            fprintf(stderr, "Cannot map file %s\n", fileName);
+            exit(-1);
+        }
+        madvise((void*) bytes, numberOfBytes, MADV_SEQUENTIAL);
+    }
+    close(descriptor);
+
+    struct Cursor cursor = { bytes, bytes + numberOfBytes, bytes };
+    if (!NextDataLine(&cursor))
+        ParseError(&cursor, "Missing size line");
+    const long long numberOfRows = ParseInteger(&cursor);
+    const long long numberOfColumns = ParseInteger(&cursor);
+    const long long numberOfEntries = ParseInteger(&cursor);
+    FinishLine(&cursor);
+    const long long numberOfVertices = numberOfRows > numberOfColumns ? numberOfRows : numberOfColumns;
+    if (numberOfVertices < 1 || numberOfVertices >= INT_MAX || numberOfEntries < 0 || numberOfEntries >= INT_MAX)
+        ParseError(&cursor, "Invalid size line");
+
+    // Split the edge lines into chunks that start right after a newline
+    const size_t remainingBytes = cursor.end - cursor.position;
+    int numberOfChunks = (int) (remainingBytes / MINIMUM_CHUNK_BYTES) + 1;
+    if (numberOfChunks > pool -> numberOfThreads)
+        numberOfChunks = pool -> numberOfThreads;
+    // Everything temporary, from the chunk table to the build arrays, is released at once
+    struct Arena* scratch = CreateArena(SCRATCH_BLOCK_BYTES);
+    struct ParseChunks chunks;
+    chunks.fileStart = bytes;
+    chunks.numberOfChunks = numberOfChunks;
+    chunks.numberOfVertices = numberOfVertices;
+    chunks.chunkStarts = (const char**) ArenaAllocate(scratch, (numberOfChunks + 1) * sizeof(const char*));
+    chunks.edgeLists = (struct EdgeList**) ArenaAllocate(scratch, numberOfChunks * sizeof(struct EdgeList*));
+    chunks.chunkStarts[0] = cursor.position;
+    chunks.chunkStarts[numberOfChunks] = cursor.end;
+    for (int chunk = 1 ; chunk < numberOfChunks ; chunk++)
+    {
+        const char* split = cursor.position + remainingBytes * chunk / numberOfChunks;
+        if (split < chunks.chunkStarts[chunk - 1])
+            split = chunks.chunkStarts[chunk - 1];
+        const char* newline = memchr(split, '\n', cursor.end - split);
+        chunks.chunkStarts[chunk] = newline != NULL ? newline + 1 : cursor.end;
+    }
+    for (int chunk = 0 ; chunk < numberOfChunks ; chunk++)
+    {
+        const size_t chunkBytes = chunks.chunkStarts[chunk + 1] - chunks.chunkStarts[chunk];
+        const long long expectedEdges = remainingBytes > 0 ? numberOfEntries * chunkBytes / remainingBytes : 0;
+        chunks.edgeLists[chunk] = CreateEdgeList((int) expectedEdges + 16);
+    }
+    RunInParallel(pool, ParseChunkTask, &chunks);
+    if (numberOfBytes > 0)
+        munmap((void*) bytes, numberOfBytes);
+    const double parsed = NowInMilliseconds();
+
+    struct Graph* graph = CreateGraphFromEdgeLists((int) numberOfVertices, chunks.edgeLists, numberOfChunks, pool, scratch); // ! O(V + E)
+    if (statistics != NULL)
+    {
+        statistics -> numberOfBytes = numberOfBytes;
+        statistics -> numberOfEdges = graph -> numberOfEdges;
+        statistics -> numberOfChunks = numberOfChunks;
+        statistics -> parseMilliseconds = parsed - start;
+        statistics -> buildMilliseconds = NowInMilliseconds() - parsed;
+        statistics -> graphBytes = graph -> arena -> reservedBytes;
+        statistics -> scratchPeakBytes = scratch -> peakBytes;
+    }
+    for (int chunk = 0 ; chunk < numberOfChunks ; chunk++)
+        DestroyEdgeList(chunks.edgeLists[chunk]);
+    DestroyArena(scratch);
+    return graph;
+}
+
+/**
+ * @brief Print how long loading took and the parse throughput
+ * ! Complexity: O(1)
+ * @param file 
+ * @param fileName 
+ * @param statistics 
+ */
+void PrintLoadStatistics(FILE* file, const char* fileName, const struct LoadStatistics* statistics)
+{
+    const double megabytes = statistics -> numberOfBytes / (1024.0 * 1024.0);
+    fprintf(file, "Loaded %s: %d edges, %.2lf MB parsed in %.3lf ms (%.1lf MB/s, %d chunks), graph built in %.3lf ms (%.2lf MB, %.2lf MB peak scratch)\n",
+        fileName, statistics -> numberOfEdges, megabytes, statistics -> parseMilliseconds,
+        statistics -> parseMilliseconds > 0 ? megabytes / (statistics -> parseMilliseconds / 1000.0) : 0.0,
+        statistics -> numberOfChunks, statistics -> buildMilliseconds,
+        statistics -> graphBytes / (1024.0 * 1024.0), statistics -> scratchPeakBytes / (1024.0 * 1024.0));
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef __LOADER_H__
+#define __LOADER_H__
+#include "Graph.h"
+#include "ThreadPool.h"
+#include <stddef.h>
+
+struct LoadStatistics {
+    size_t numberOfBytes;
+    int numberOfEdges;
+    int numberOfChunks;
+    double parseMilliseconds;
+    double buildMilliseconds;
+    size_t graphBytes;          // the graph's arena
+    size_t scratchPeakBytes;    // temporaries of the build, edge lists aside
+};
+
+// Public Methods:
+struct Graph* LoadMtxFile(const char* fileName, struct ThreadPool* pool, struct LoadStatistics* statistics);
+
+void PrintLoadStatistics(FILE* file, const char* fileName, const struct LoadStatistics* statistics);
+
+#endif
\ No newline at end of file
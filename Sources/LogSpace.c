@@ -0,0 +1,63 @@
+#include "LogSpace.h"
+#include "Semiring.h"
+#include <math.h>
+
+// Public Methods:
+/**
+ * @brief Turn the link reliabilities of a graph into log-space weights, -ln(p) or, with
+ * a positive scale, round(-ln(p) * scale). Links of reliability 0 can never be on a
+ * path and are dropped. Reliabilities outside [0, 1] are rejected.
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @param scale (0: floating point)
+ */
+void ConvertGraphToLogSpace(struct Graph* graph, const double scale)
+{
+    MakeGraphWritable(graph); // ! O(V + E) for a snapshot, O(1) otherwise
+    int position = 0;
+    for (int index = 0 ; index < graph -> numberOfVertices ; index++)
+    {
+        const int edgeEnd = graph -> edgeOffsets[index + 1];
+        int edge = graph -> edgeOffsets[index];
+        graph -> edgeOffsets[index] = position;
+        for ( ; edge < edgeEnd ; edge++)
+        {
+            const double reliability = graph -> edgeWeights[edge];
+            if (!(reliability >= 0.0 && reliability <= 1.0))
+            {
+                fprintf(stderr, "Log space needs reliabilities between 0 and 1, link %d -> %d has %lf\n", index + 1, graph -> edgeTargets[edge], reliability);
+                exit(-1);
+            }
+            if (reliability == 0.0)
+                continue;
+            // 0.0 - log(1.0) is +0.0 rather than -0.0
+            const double weight = 0.0 - log(reliability);
+            graph -> edgeTargets[position] = graph -> edgeTargets[edge];
+            graph -> edgeWeights[position ++] = scale > 0.0 ? round(weight * scale) : weight;
+        }
+    }
+    graph -> edgeOffsets[graph -> numberOfVertices] = position;
+    graph -> numberOfEdges = position;
+}
+
+/**
+ * @brief Turn the weights of a finished additive search on a log-space graph back into
+ * reliabilities, and make the state's source and unreachable weights the reliability
+ * ones, so it reads exactly like a search of the reliability metric
+ * ! Complexity: O(V)
+ * @param state 
+ * @param scale (the one the graph was converted with)
+ */
+void ConvertStateFromLogSpace(struct SearchState* state, const double scale)
+{
+    const double unitWeight = scale > 0.0 ? 1.0 / scale : 1.0;
+    for (int index = 0 ; index < state -> numberOfVertices ; index++)
+    {
+        if (state -> weights[index] == state -> unreachableWeight)
+            state -> weights[index] = RELIABILITY_UNREACHABLE;
+        else
+            state -> weights[index] = exp(-state -> weights[index] * unitWeight);
+    }
+    state -> sourceWeight = RELIABILITY_IDENTITY;
+    state -> unreachableWeight = RELIABILITY_UNREACHABLE;
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef __LOGSPACE_H__
+#define __LOGSPACE_H__
+#include "Graph.h"
+#include "Search.h"
+
+/**
+ * Reliability (binary B) in log space: a link of reliability p becomes an
+ * additive edge of weight -ln(p), so the most reliable path is the shortest
+ * one. The additive engine (min-queue keys, plain sums, delta-stepping) then
+ * answers the query, and long paths no longer underflow to 0 during the
+ * search (b.txt can still only show reliabilities a double can hold).
+ *
+ * With a fixed-point scale s > 0 every weight is rounded to a whole number of
+ * units of 1/s (kept as an integral double, exact up to 2^53), so path weights
+ * are exact integer sums: every queue backend and delta-stepping find the very
+ * same weights, whatever order they add them in.
+ *
+ * Tolerance against the multiplicative engine, for a best path of L links:
+ *   floating point (s = 0): relative error in p of about L * 1e-15;
+ *   fixed point (s > 0): each link is off by at most 0.5 / s in -ln(p), so p is
+ *   off by a factor of at most exp(L / (2s)), a relative error of about L / (2s).
+ * If several paths are that close, either may be reported.
+ */
+
+// The additive engine reads path weights from INT_MAX up as unreachable; this scale keeps
+// -ln(p) * scale below that for every p a double can hold (down to 4.9e-324, -ln(p) = 744.4)
+#define MAXIMUM_LOG_SCALE 2.8e6
+
+// Public Methods:
+void ConvertGraphToLogSpace(struct Graph* graph, const double scale);
+
+void ConvertStateFromLogSpace(struct SearchState* state, const double scale);
+
+#endif
\ No newline at end of file
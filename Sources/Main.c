@@ -0,0 +1,1051 @@
+#include "PriorityQueue.h"
+#include "Dijkstra.h"
+#include "DeltaStepping.h"
+#include "Batch.h"
+#include "AllPairs.h"
+#include "Landmarks.h"
+#include "ContractionHierarchy.h"
+#include "Dynamic.h"
+#include "LogSpace.h"
+#include "Output.h"
+#include "CompactGraph.h"
+#include "Reorder.h"
+#include "Instrument.h"
+#include "Graph.h"
+#include "Loader.h"
+#include "Snapshot.h"
+#include "Search.h"
+#include "Timer.h"
+#include "ThreadPool.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+// Metric and output file used when -m is not given; set per binary by the Makefile
+#ifndef DEFAULT_METRIC
+#define DEFAULT_METRIC "additive"
+#endif
+#ifndef DEFAULT_OUTPUT
+#define DEFAULT_OUTPUT "a.txt"
+#endif
+
+/**
+ * @brief Print the paths from the source of the search state to every other vertex,
+ * or only to the target vertex if targetId is not -1. One path buffer serves them all.
+ * ! Complexity: O(V * depth)
+ * @param state 
+ * @param targetId 
+ */
+void FindMaximumReliabilityPaths(const struct SearchState* state, const int targetId)
+{
+    int* path = (int*) malloc(state -> numberOfVertices * sizeof(int));
+    for (int vertexId = 1 ; vertexId <= state -> numberOfVertices ; vertexId++)
+    {
+        if (vertexId == state -> sourceId || (targetId != -1 && vertexId != targetId))
+            continue;
+        const int length = GetPath(state, vertexId, path); // ! O(depth)
+        printf("Longest Path From Vertex %d to Vertex %d:\n", state -> sourceId, vertexId);
+        for (int position = 0 ; position < length - 1 ; position++)
+            printf("%d -> ", path[position]);
+        printf("%d\n", path[length - 1]);
+    }
+    free(path);
+}
+
+// Set by -z: only the requested results are written, errors aside
+static bool isQuiet = false;
+
+/**
+ * @brief Print a progress line to stderr unless in quiet mode
+ * ! Complexity: O(1)
+ * @param format 
+ * @param ... 
+ */
+static void Report(const char* format, ...)
+{
+    if (isQuiet)
+        return;
+    va_list arguments;
+    va_start(arguments, format);
+    vfprintf(stderr, format, arguments);
+    va_end(arguments);
+}
+
+
+int CompareDoubles(const void* first, const void* second)
+{
+    const double difference = *(const double*) first - *(const double*) second;
+    return (difference > 0) - (difference < 0);
+}
+
+/**
+ * @brief Time the same query on every priority-queue backend (and on the metric's
+ * queue-free search and on delta-stepping, if available) and check that their results agree
+ * ! Complexity: O(backends * repetitions * (V + E)lgV)
+ * @param graph 
+ * @param metric 
+ * @param deltaStepping (NULL to skip it)
+ * @param sourceId 
+ * @param targetId 
+ * @param isLazy 
+ * @param repetitions 
+ */
+void BenchmarkQueues(const struct Graph* graph, const struct Metric* metric, struct DeltaStepping* deltaStepping, const int sourceId, const int targetId, const bool isLazy, const int repetitions)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    struct SearchState* state = CreateSearchStateForMetric(metric, numberOfVertices);
+    double* referenceWeights = (double*) malloc(numberOfVertices * sizeof(double));
+    double* times = (double*) malloc(repetitions * sizeof(double));
+    printf("%-8s %10s %12s %12s %8s\n", "Queue", "Settled", "Min (ms)", "Median (ms)", "Result");
+    const int numberOfQueueFreeRuns = metric -> RunWithoutQueue != NULL;
+    const int numberOfRuns = NUMBER_OF_QUEUE_BACKENDS + numberOfQueueFreeRuns + (deltaStepping != NULL);
+    for (int backend = 0 ; backend < numberOfRuns ; backend++)
+    {
+        // The runs after the last backend are the queue-free search, then delta-stepping
+        struct PriorityQueue* queue = NULL;
+        const char* name = backend < NUMBER_OF_QUEUE_BACKENDS + numberOfQueueFreeRuns ? "none" : "delta";
+        if (backend < NUMBER_OF_QUEUE_BACKENDS)
+        {
+            queue = CreatePriorityQueue(QUEUE_BACKENDS[backend], numberOfVertices);
+            name = QUEUE_BACKENDS[backend] -> name;
+        }
+        const bool isDeltaStepping = backend >= NUMBER_OF_QUEUE_BACKENDS + numberOfQueueFreeRuns;
+        int numberOfSettled = 0;
+        for (int repetition = 0 ; repetition < repetitions ; repetition++)
+        {
+            ResetSearchState(state, sourceId);
+            const double start = NowInMilliseconds();
+            if (isDeltaStepping)
+                numberOfSettled = RunDeltaStepping(deltaStepping, state, targetId);
+            else
+                numberOfSettled = RunMetricQuery(metric, graph, state, queue, isLazy, targetId);
+            times[repetition] = NowInMilliseconds() - start;
+        }
+        bool isMatching = true;
+        for (int index = 0 ; index < numberOfVertices ; index++)
+        {
+            if (targetId != -1 && index != targetId - 1)
+                continue;
+            if (backend == 0)
+                referenceWeights[index] = state -> weights[index];
+            else if (fabs(state -> weights[index] - referenceWeights[index]) > 1e-9 * fabs(referenceWeights[index]))
+                isMatching = false;
+        }
+        qsort(times, repetitions, sizeof(double), CompareDoubles);
+        printf("%-8s %10d %12.3lf %12.3lf %8s\n", name, numberOfSettled, times[0], times[repetitions / 2], isMatching ? "ok" : "MISMATCH");
+        if (queue != NULL)
+            DestroyPriorityQueue(queue);
+    }
+    free(times);
+    free(referenceWeights);
+    DestroySearchState(state);
+}
+
+/**
+ * @brief Compare the CSR graph with its float32 and uint16 encodings: the bytes each takes,
+ * the largest weight error of the encoding, the time of the search on it and the largest
+ * difference of its results from the CSR ones
+ * ! Complexity: O(E lgE + repetitions * (V + E)lgV)
+ * @param graph 
+ * @param metric 
+ * @param queueBackend 
+ * @param sourceId 
+ * @param targetId 
+ * @param isLazy 
+ * @param repetitions 
+ */
+void BenchmarkEncodings(const struct Graph* graph, const struct Metric* metric, const struct QueueOperations* queueBackend, const int sourceId, const int targetId, const bool isLazy, const int repetitions)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    const char* names[] = {"csr", "float32", "uint16"};
+    const enum WeightEncoding encodings[] = {WEIGHTS_FLOAT32, WEIGHTS_FLOAT32, WEIGHTS_UINT16};
+    struct SearchState* state = CreateSearchStateForMetric(metric, numberOfVertices);
+    struct PriorityQueue* queue = CreatePriorityQueue(queueBackend, numberOfVertices);
+    double* referenceWeights = (double*) malloc(numberOfVertices * sizeof(double));
+    double* times = (double*) malloc(repetitions * sizeof(double));
+    printf("%-8s %10s %10s %12s %12s %12s %12s\n", "Encoding", "MB", "Bytes/edge", "Edge error", "Min (ms)", "Median (ms)", "Max diff");
+    for (int run = 0 ; run < 3 ; run++)
+    {
+        struct CompactGraph* compactGraph = run > 0 ? CreateCompactGraph(graph, encodings[run]) : NULL;
+        const size_t numberOfBytes = run > 0 ? GetCompactGraphBytes(compactGraph) : GetGraphBytes(graph);
+        for (int repetition = 0 ; repetition < repetitions ; repetition++)
+        {
+            ResetSearchState(state, sourceId);
+            const double start = NowInMilliseconds();
+            if (run > 0)
+                RunCompactQuery(metric, compactGraph, state, queue, isLazy, targetId);
+            else
+                RunMetricQuery(metric, graph, state, queue, isLazy, targetId);
+            times[repetition] = NowInMilliseconds() - start;
+        }
+        double maximumDifference = 0.0;
+        for (int index = 0 ; index < numberOfVertices ; index++)
+        {
+            const double weight = state -> heapIndices[index] == SETTLED ? state -> weights[index] : metric -> unreachable;
+            if (run == 0)
+                referenceWeights[index] = weight;
+            else if (weight != referenceWeights[index])
+            {
+                // A vertex reached in one run only counts as an infinite difference
+                const bool isEitherUnreachable = weight == metric -> unreachable || referenceWeights[index] == metric -> unreachable;
+                const double difference = isEitherUnreachable ? INFINITY : fabs(weight - referenceWeights[index]);
+                if (difference > maximumDifference)
+                    maximumDifference = difference;
+            }
+        }
+        qsort(times, repetitions, sizeof(double), CompareDoubles);
+        printf("%-8s %10.2lf %10.2lf %12lg %12.3lf %12.3lf %12lg\n", names[run], numberOfBytes / (1024.0 * 1024.0),
+            graph -> numberOfEdges > 0 ? (double) numberOfBytes / graph -> numberOfEdges : 0.0,
+            run > 0 ? compactGraph -> maximumError : 0.0, times[0], times[repetitions / 2], maximumDifference);
+        if (compactGraph != NULL)
+            DestroyCompactGraph(compactGraph);
+    }
+    free(times);
+    free(referenceWeights);
+    DestroyPriorityQueue(queue);
+    DestroySearchState(state);
+}
+
+/**
+ * @brief Compare the input order of the vertices with the BFS, reverse Cuthill-McKee and
+ * degree orders: the time to relabel, the average and largest id gap of an edge, the time
+ * and hardware cache misses of the search on the relabeled graph (- where the kernel offers
+ * no counter) and whether its results, mapped back, agree with those on the input order
+ * ! Complexity: O(VlgV + E lg deg + repetitions * (V + E)lgV)
+ * @param graph 
+ * @param metric 
+ * @param queueBackend NULL for the metric's queue-free search
+ * @param sourceId 
+ * @param targetId 
+ * @param isLazy 
+ * @param repetitions 
+ */
+void BenchmarkOrders(const struct Graph* graph, const struct Metric* metric, const struct QueueOperations* queueBackend, const int sourceId, const int targetId, const bool isLazy, const int repetitions)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    const char* names[] = {"none", "bfs", "rcm", "degree"};
+    const enum VertexOrder orders[] = {ORDER_NONE, ORDER_BFS, ORDER_RCM, ORDER_DEGREE};
+    struct SearchState* state = CreateSearchStateForMetric(metric, numberOfVertices);
+    struct PriorityQueue* queue = queueBackend != NULL ? CreatePriorityQueue(queueBackend, numberOfVertices) : NULL;
+    double* referenceWeights = (double*) malloc(numberOfVertices * sizeof(double));
+    double* times = (double*) malloc(repetitions * sizeof(double));
+    printf("%-8s %12s %10s %10s %12s %12s %12s %8s\n", "Order", "Relabel (ms)", "Avg gap", "Bandwidth", "Min (ms)", "Median (ms)", "Misses/run", "Check");
+    for (int run = 0 ; run < 4 ; run++)
+    {
+        const double start = NowInMilliseconds();
+        struct Relabeling* relabeling = CreateRelabeling(graph, orders[run]);
+        struct Graph* relabeledGraph = RelabelGraph(graph, relabeling);
+        const double relabelTime = NowInMilliseconds() - start;
+        int bandwidth;
+        const double averageGap = GetAverageEdgeGap(relabeledGraph, &bandwidth);
+        const int relabeledTargetId = targetId != -1 ? relabeling -> newIds[targetId - 1] : -1;
+        const int counter = OpenCacheMissCounter();
+        long long numberOfMisses = 0;
+        for (int repetition = 0 ; repetition < repetitions ; repetition++)
+        {
+            ResetSearchState(state, relabeling -> newIds[sourceId - 1]);
+            const long long firstCount = ReadCounter(counter);
+            const double start = NowInMilliseconds();
+            RunMetricQuery(metric, relabeledGraph, state, queue, isLazy, relabeledTargetId);
+            times[repetition] = NowInMilliseconds() - start;
+            numberOfMisses += ReadCounter(counter) - firstCount;
+        }
+        CloseCounter(counter);
+        RestoreSearchState(state, relabeling);
+        // Equal-weight ties may resolve to other paths, so the weights only agree up to rounding
+        bool isMatching = true;
+        for (int index = 0 ; index < numberOfVertices ; index++)
+        {
+            const double weight = state -> heapIndices[index] == SETTLED ? state -> weights[index] : metric -> unreachable;
+            if (run == 0)
+                referenceWeights[index] = weight;
+            else if (weight != referenceWeights[index] && !(fabs(weight - referenceWeights[index]) <= 1e-9 * fabs(referenceWeights[index])))
+                isMatching = false;
+        }
+        char misses[32] = "-";
+        if (counter >= 0)
+            snprintf(misses, sizeof(misses), "%lld", numberOfMisses / repetitions);
+        qsort(times, repetitions, sizeof(double), CompareDoubles);
+        printf("%-8s %12.3lf %10.1lf %10d %12.3lf %12.3lf %12s %8s\n", names[run], relabelTime, averageGap, bandwidth, times[0], times[repetitions / 2], misses, isMatching ? "ok" : "MISMATCH");
+        DestroyGraph(relabeledGraph);
+        DestroyRelabeling(relabeling);
+    }
+    free(times);
+    free(referenceWeights);
+    if (queue != NULL)
+        DestroyPriorityQueue(queue);
+    DestroySearchState(state);
+}
+
+/**
+ * @brief Print the path of a point-to-point query and its weight, or that there is none
+ * ! Complexity: O(path length)
+ * @param sourceId 
+ * @param targetId 
+ * @param path 
+ * @param length (0 if the target is unreachable)
+ * @param weight 
+ */
+void PrintPointToPointPath(const int sourceId, const int targetId, const int* path, const int length, const double weight)
+{
+    if (length == 0)
+    {
+        printf("Vertex %d is unreachable from Vertex %d\n", targetId, sourceId);
+        return;
+    }
+    printf("Longest Path From Vertex %d to Vertex %d:\n", sourceId, targetId);
+    for (int index = 0 ; index < length - 1 ; index++)
+        printf("%d -> ", path[index]);
+    printf("%d\n", path[length - 1]);
+    printf("Weight: %0.8lf\n", weight);
+}
+
+/**
+ * @brief Time a point-to-point query one-directionally (stopping at the target), then
+ * bidirectionally (if reverseGraph is not NULL), with A* (if landmarks is not NULL) and
+ * on a contraction hierarchy (if hierarchy is not NULL), and check that all of them
+ * find the same weight
+ * ! Complexity: O(repetitions * (V + E)lgV)
+ * @param graph 
+ * @param reverseGraph (NULL to skip the bidirectional search)
+ * @param landmarks (NULL to skip A*)
+ * @param hierarchy (NULL to skip the hierarchy query)
+ * @param metric 
+ * @param queueBackend 
+ * @param sourceId 
+ * @param targetId 
+ * @param repetitions 
+ */
+void BenchmarkPointToPoint(const struct Graph* graph, const struct Graph* reverseGraph, const struct Landmarks* landmarks, const struct ContractionHierarchy* hierarchy, const struct Metric* metric, const struct QueueOperations* queueBackend, const int sourceId, const int targetId, const int repetitions)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    struct SearchState* forward = CreateSearchStateForMetric(metric, numberOfVertices);
+    struct SearchState* backward = CreateSearchStateForMetric(metric, numberOfVertices);
+    struct PriorityQueue* forwardQueue = CreatePriorityQueue(queueBackend, numberOfVertices);
+    struct PriorityQueue* backwardQueue = CreatePriorityQueue(queueBackend, numberOfVertices);
+    double* times = (double*) malloc(repetitions * sizeof(double));
+    printf("%-14s %10s %12s %12s %8s\n", "Search", "Settled", "Min (ms)", "Median (ms)", "Result");
+
+    int numberOfSettled = 0;
+    for (int repetition = 0 ; repetition < repetitions ; repetition++)
+    {
+        ResetSearchState(forward, sourceId);
+        const double start = NowInMilliseconds();
+        numberOfSettled = RunMetricQuery(metric, graph, forward, forwardQueue, true, targetId);
+        times[repetition] = NowInMilliseconds() - start;
+    }
+    const double referenceWeight = forward -> heapIndices[targetId - 1] == SETTLED ? forward -> weights[targetId - 1] : metric -> unreachable;
+    qsort(times, repetitions, sizeof(double), CompareDoubles);
+    printf("%-14s %10d %12.3lf %12.3lf %8s\n", "unidirectional", numberOfSettled, times[0], times[repetitions / 2], "ok");
+
+    if (reverseGraph != NULL)
+    {
+        struct BidirectionalResult result;
+        for (int repetition = 0 ; repetition < repetitions ; repetition++)
+        {
+            ResetSearchState(forward, sourceId);
+            ResetSearchState(backward, targetId);
+            const double start = NowInMilliseconds();
+            metric -> RunBidirectional(graph, reverseGraph, forward, backward, forwardQueue, backwardQueue, &result);
+            times[repetition] = NowInMilliseconds() - start;
+        }
+        const bool isMatching = result.weight == referenceWeight || fabs(result.weight - referenceWeight) <= 1e-9 * fabs(referenceWeight);
+        qsort(times, repetitions, sizeof(double), CompareDoubles);
+        printf("%-14s %10d %12.3lf %12.3lf %8s\n", "bidirectional", result.numberOfForwardSettled + result.numberOfBackwardSettled, times[0], times[repetitions / 2], isMatching ? "ok" : "MISMATCH");
+    }
+    if (landmarks != NULL)
+    {
+        for (int repetition = 0 ; repetition < repetitions ; repetition++)
+        {
+            ResetSearchState(forward, sourceId);
+            const double start = NowInMilliseconds();
+            numberOfSettled = metric -> RunAStar(graph, forward, forwardQueue, targetId, landmarks);
+            times[repetition] = NowInMilliseconds() - start;
+        }
+        const double weight = forward -> heapIndices[targetId - 1] == SETTLED ? forward -> weights[targetId - 1] : metric -> unreachable;
+        const bool isMatching = weight == referenceWeight || fabs(weight - referenceWeight) <= 1e-9 * fabs(referenceWeight);
+        qsort(times, repetitions, sizeof(double), CompareDoubles);
+        printf("%-14s %10d %12.3lf %12.3lf %8s\n", "alt", numberOfSettled, times[0], times[repetitions / 2], isMatching ? "ok" : "MISMATCH");
+    }
+    if (hierarchy != NULL)
+    {
+        struct BidirectionalResult result;
+        for (int repetition = 0 ; repetition < repetitions ; repetition++)
+        {
+            ResetSearchState(forward, sourceId);
+            ResetSearchState(backward, targetId);
+            const double start = NowInMilliseconds();
+            QueryContractionHierarchy(hierarchy, metric, forward, backward, forwardQueue, backwardQueue, &result);
+            times[repetition] = NowInMilliseconds() - start;
+        }
+        const bool isMatching = result.weight == referenceWeight || fabs(result.weight - referenceWeight) <= 1e-9 * fabs(referenceWeight);
+        qsort(times, repetitions, sizeof(double), CompareDoubles);
+        printf("%-14s %10d %12.3lf %12.3lf %8s\n", "ch", result.numberOfForwardSettled + result.numberOfBackwardSettled, times[0], times[repetitions / 2], isMatching ? "ok" : "MISMATCH");
+    }
+
+    free(times);
+    DestroyPriorityQueue(forwardQueue);
+    DestroyPriorityQueue(backwardQueue);
+    DestroySearchState(forward);
+    DestroySearchState(backward);
+}
+
+/**
+ * @brief Answer a point-to-point query on the contraction hierarchy if it is not NULL,
+ * with A* if landmarks is not NULL, with a bidirectional search otherwise, and print
+ * its path, weight and settled vertices
+ * ! Complexity: O((V + E)lgV)
+ * @param graph 
+ * @param reverseGraph 
+ * @param landmarks (NULL for the bidirectional search)
+ * @param hierarchy (NULL for A* or the bidirectional search)
+ * @param metric 
+ * @param queueBackend 
+ * @param sourceId 
+ * @param targetId 
+ */
+void RunPointToPointQuery(const struct Graph* graph, const struct Graph* reverseGraph, const struct Landmarks* landmarks, const struct ContractionHierarchy* hierarchy, const struct Metric* metric, const struct QueueOperations* queueBackend, const int sourceId, const int targetId)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    struct SearchState* forward = CreateSearchStateForMetric(metric, numberOfVertices);
+    struct SearchState* backward = CreateSearchStateForMetric(metric, numberOfVertices);
+    struct PriorityQueue* forwardQueue = CreatePriorityQueue(queueBackend, numberOfVertices);
+    struct PriorityQueue* backwardQueue = CreatePriorityQueue(queueBackend, numberOfVertices);
+    int* path = (int*) malloc(numberOfVertices * sizeof(int));
+    int length = 0;
+    double weight = metric -> unreachable;
+    ResetSearchState(forward, sourceId);
+    if (hierarchy != NULL)
+    {
+        ResetSearchState(backward, targetId);
+        struct BidirectionalResult result;
+        QueryContractionHierarchy(hierarchy, metric, forward, backward, forwardQueue, backwardQueue, &result);
+        length = GetHierarchyPath(hierarchy, forward, backward, result.meetingVertexId, path);
+        PrintPointToPointPath(sourceId, targetId, path, length, result.weight);
+        printf("Settled: %d forward + %d backward\n", result.numberOfForwardSettled, result.numberOfBackwardSettled);
+    }
+    else if (landmarks != NULL)
+    {
+        const int numberOfSettled = metric -> RunAStar(graph, forward, forwardQueue, targetId, landmarks);
+        if (forward -> heapIndices[targetId - 1] == SETTLED)
+        {
+            weight = forward -> weights[targetId - 1];
+            length = GetPath(forward, targetId, path);
+        }
+        PrintPointToPointPath(sourceId, targetId, path, length, weight);
+        printf("Settled: %d\n", numberOfSettled);
+    }
+    else
+    {
+        ResetSearchState(backward, targetId);
+        struct BidirectionalResult result;
+        metric -> RunBidirectional(graph, reverseGraph, forward, backward, forwardQueue, backwardQueue, &result);
+        length = GetBidirectionalPath(forward, backward, result.meetingVertexId, path);
+        PrintPointToPointPath(sourceId, targetId, path, length, result.weight);
+        printf("Settled: %d forward + %d backward\n", result.numberOfForwardSettled, result.numberOfBackwardSettled);
+    }
+
+    free(path);
+    DestroyPriorityQueue(forwardQueue);
+    DestroyPriorityQueue(backwardQueue);
+    DestroySearchState(forward);
+    DestroySearchState(backward);
+}
+
+/**
+ * @brief Main Method
+ * ! Complexity: O(E + VlgV) currently
+ * @param argc 
+ * @param argv 
+ * @return int 
+ */
+int main(int argc, char* argv[])
+{
+    // Parse options: -s <source vertex> (default 1), -t <target vertex> (default none),
+    // -l lazy queue initialization, -q <queue backend> (default binary, or none for hops),
+    // -m <metric> additive, reliability, widest or hops (default DEFAULT_METRIC),
+    // -b <repetitions> benchmark every queue backend instead of printing results,
+    // -j <threads> used for loading and delta-stepping (default: number of processors),
+    // -d <delta> parallel delta-stepping with bucket width delta (0: chosen from the graph), additive only,
+    // -B <query file> answer the "source [target]" queries of the file concurrently and print them in order,
+    // -A <matrix file> write the all-pairs weight matrix, -F float32|float64 its element type (default float64),
+    // -R <first:last> only the rows of these sources (default all),
+    // -p answer the -s/-t query with a bidirectional search (with -b: compare it to the one-directional one),
+    // -L <landmarks> answer it with A* on ALT bounds, cached in <file>.<metric>.alt (with -b: compare as -p does),
+    // -H answer it on a contraction hierarchy, cached in <file>.<metric>.ch (with -b: compare as -p does),
+    // -U <update file> apply its edge updates after the search and repair the shortest-path tree,
+    // -P paths|parents|tree|none how to print the paths: each in full (default), the parent array,
+    // the tree in depth-first order (both O(V)) or not at all,
+    // -g run the reliability metric as additive -ln(p) weights, -Q <scale> the same in fixed point
+    // with round(-ln(p) * scale) weights (see LogSpace.h for the tolerance),
+    // -E float32|uint16 search a compact copy of the graph with these weights and
+    // delta/varint-encoded neighbours, dropping the CSR arrays (with -b: compare the footprint
+    // and search time of both encodings with the CSR graph),
+    // -V rcm|bfs|degree relabel the vertices in this order for locality before the search and
+    // map the results back to the input ids (with -b: compare every order with the input one),
+    // -o <result file> where the single-source results go (default DEFAULT_OUTPUT, - for stdout),
+    // -O text|binary|csv their format (see Output.h, default text),
+    // -z quiet: no vertex dump, progress or greeting, and no paths unless -P asks for them,
+    // -J <report file> write the wall time of each phase of a single-source search, the peak
+    // memory and, in builds with INSTRUMENTATION (make instrumented), the operation counters
+    // of the search as JSON (- for stdout, see Instrument.h),
+    // -C <snapshot> convert the input to a binary snapshot and exit, -K verify snapshot checksums
+    const char* snapshotName = NULL;
+    bool isVerifying = false;
+    int sourceId = 1, targetId = -1, repetitions = 0, numberOfThreads = GetDefaultNumberOfThreads(), option;
+    bool isLazy = false;
+    const struct QueueOperations* queueBackend = NULL;
+    bool isQueueFree = false;
+    double delta = -1.0;
+    const char* queryFileName = NULL;
+    const char* matrixFileName = NULL;
+    enum MatrixFormat matrixFormat = MATRIX_FLOAT64;
+    int firstSourceId = 1, lastSourceId = -1;
+    bool isBidirectional = false;
+    int numberOfLandmarks = 0;
+    bool isHierarchical = false;
+    const char* updateFileName = NULL;
+    enum PathFormat pathFormat = PATHS_LISTED;
+    bool isPathFormatGiven = false;
+    bool isLogSpace = false;
+    double logScale = 0.0;
+    const char* outputFileName = DEFAULT_OUTPUT;
+    enum OutputFormat outputFormat = OUTPUT_TEXT;
+    bool isCompact = false;
+    enum WeightEncoding weightEncoding = WEIGHTS_FLOAT32;
+    bool isReordering = false;
+    enum VertexOrder vertexOrder = ORDER_NONE;
+    const char* vertexOrderName = NULL;
+    const char* reportFileName = NULL;
+    struct PhaseTimer phases = {0};
+    const struct Metric* metric = FindMetric(DEFAULT_METRIC);
+    while ((option = getopt(argc, argv, "s:t:lq:m:b:j:d:B:A:F:R:pL:HU:P:gQ:E:V:o:O:zJ:C:K")) != -1)
+    {
+        switch (option)
+        {
+            case 's':
+                sourceId = atoi(optarg);
+                break;
+            case 't':
+                targetId = atoi(optarg);
+                break;
+            case 'l':
+                isLazy = true;
+                break;
+            case 'q':
+                queueBackend = FindQueueBackend(optarg);
+                isQueueFree = strcmp(optarg, "none") == 0;
+                if (queueBackend == NULL && !isQueueFree)
+                {
+                    fprintf(stderr, "Unknown queue %s (binary, dary4, dary8, pairing, radix, none)\n", optarg);
+                    exit(-1);
+                }
+                break;
+            case 'm':
+                metric = FindMetric(optarg);
+                if (metric == NULL)
+                {
+                    fprintf(stderr, "Unknown metric %s (additive, reliability, widest, hops)\n", optarg);
+                    exit(-1);
+                }
+                break;
+            case 'b':
+                repetitions = atoi(optarg);
+                break;
+            case 'j':
+                numberOfThreads = atoi(optarg);
+                break;
+            case 'd':
+                delta = atof(optarg);
+                if (delta < 0.0)
+                {
+                    fprintf(stderr, "Delta must not be negative\n");
+                    exit(-1);
+                }
+                break;
+            case 'B':
+                queryFileName = optarg;
+                break;
+            case 'A':
+                matrixFileName = optarg;
+                break;
+            case 'F':
+                if (!ParseMatrixFormat(optarg, &matrixFormat))
+                {
+                    fprintf(stderr, "Unknown matrix format %s (float32, float64)\n", optarg);
+                    exit(-1);
+                }
+                break;
+            case 'R':
+                if (!ParseRowRange(optarg, &firstSourceId, &lastSourceId))
+                {
+                    fprintf(stderr, "Row range must look like first:last, got %s\n", optarg);
+                    exit(-1);
+                }
+                break;
+            case 'p':
+                isBidirectional = true;
+                break;
+            case 'L':
+                numberOfLandmarks = atoi(optarg);
+                if (numberOfLandmarks < 1)
+                {
+                    fprintf(stderr, "Number of landmarks must be positive\n");
+                    exit(-1);
+                }
+                break;
+            case 'H':
+                isHierarchical = true;
+                break;
+            case 'U':
+                updateFileName = optarg;
+                break;
+            case 'P':
+                if (!ParsePathFormat(optarg, &pathFormat))
+                {
+                    fprintf(stderr, "Unknown path format %s (paths, parents, tree, none)\n", optarg);
+                    exit(-1);
+                }
+                isPathFormatGiven = true;
+                break;
+            case 'g':
+                isLogSpace = true;
+                break;
+            case 'Q':
+                isLogSpace = true;
+                logScale = atof(optarg);
+                if (logScale <= 0.0 || logScale > MAXIMUM_LOG_SCALE)
+                {
+                    fprintf(stderr, "Fixed-point scale must be positive and at most %lg\n", MAXIMUM_LOG_SCALE);
+                    exit(-1);
+                }
+                break;
+            case 'E':
+                if (!ParseWeightEncoding(optarg, &weightEncoding))
+                {
+                    fprintf(stderr, "Unknown weight encoding %s (float32, uint16)\n", optarg);
+                    exit(-1);
+                }
+                isCompact = true;
+                break;
+            case 'V':
+                if (!ParseVertexOrder(optarg, &vertexOrder))
+                {
+                    fprintf(stderr, "Unknown vertex order %s (none, bfs, rcm, degree)\n", optarg);
+                    exit(-1);
+                }
+                vertexOrderName = optarg;
+                isReordering = true;
+                break;
+            case 'o':
+                outputFileName = optarg;
+                break;
+            case 'O':
+                if (!ParseOutputFormat(optarg, &outputFormat))
+                {
+                    fprintf(stderr, "Unknown output format %s (text, binary, csv)\n", optarg);
+                    exit(-1);
+                }
+                break;
+            case 'z':
+                isQuiet = true;
+                break;
+            case 'J':
+                reportFileName = optarg;
+                break;
+            case 'C':
+                snapshotName = optarg;
+                break;
+            case 'K':
+                isVerifying = true;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-s source] [-t target] [-l] [-q queue] [-m metric] [-b repetitions] [-j threads] [-d delta] [-B queries] [-A matrix [-F format] [-R first:last]] [-p] [-L landmarks] [-H] [-U updates] [-P format] [-g] [-Q scale] [-E encoding] [-V order] [-o results] [-O format] [-z] [-J report] [-C snapshot] [-K] <file.mtx | snapshot>\n", argv[0]);
+                exit(-1);
+        }
+    }
+    if (isQuiet && !isPathFormatGiven)
+        pathFormat = PATHS_NONE;
+    if (reportFileName != NULL && (isBidirectional || numberOfLandmarks > 0 || isHierarchical || queryFileName != NULL || matrixFileName != NULL || repetitions > 0 || snapshotName != NULL))
+    {
+        fprintf(stderr, "Phase reports (-J) cover single-source searches and cannot be combined with -p, -L, -H, -B, -A, -b or -C\n");
+        exit(-1);
+    }
+    // Read .mtx file and create the graph
+    if (argc - optind != 1)
+    {
+        fprintf(stderr, "Invalid number of arguments");
+        exit(-1);
+    }
+    const char* fileName = argv[optind];
+    struct ThreadPool* pool = CreateThreadPool(numberOfThreads);
+    struct Graph* graph;
+    StartPhase(&phases, "load");
+    if (IsGraphSnapshot(fileName))
+    {
+        const double start = NowInMilliseconds();
+        graph = LoadGraphSnapshot(fileName, isVerifying); // ! O(1)
+        Report("Mapped %s: %d vertices, %d edges in %.3lf ms\n", fileName, graph -> numberOfVertices, graph -> numberOfEdges, NowInMilliseconds() - start);
+    }
+    else
+    {
+        struct LoadStatistics loadStatistics;
+        graph = LoadMtxFile(fileName, pool, &loadStatistics); // ! O(V + E)
+        if (!isQuiet)
+            PrintLoadStatistics(stderr, fileName, &loadStatistics);
+    }
+    if (snapshotName != NULL)
+    {
+        WriteGraphSnapshot(graph, snapshotName); // ! O(V + E)
+        Report("Wrote snapshot %s\n", snapshotName);
+        DestroyGraph(graph);
+        DestroyThreadPool(pool);
+        return 0;
+    }
+    // The metric the user asked for, even after log space swaps in the additive one
+    const char* metricName = metric -> name;
+    if (isLogSpace)
+    {
+        if (strcmp(metric -> name, "reliability") != 0 || isBidirectional || numberOfLandmarks > 0 || isHierarchical || queryFileName != NULL || matrixFileName != NULL || updateFileName != NULL)
+        {
+            fprintf(stderr, "Log space (-g, -Q) applies to single-source reliability searches and cannot be combined with -p, -L, -H, -B, -A or -U\n");
+            exit(-1);
+        }
+        StartPhase(&phases, "log-space");
+        const double start = NowInMilliseconds();
+        ConvertGraphToLogSpace(graph, logScale); // ! O(V + E)
+        metric = FindMetric("additive");
+        if (logScale > 0.0)
+            Report("Converted %d links to fixed-point -ln(p) weights (scale %lg) in %.3lf ms\n", graph -> numberOfEdges, logScale, NowInMilliseconds() - start);
+        else
+            Report("Converted %d links to -ln(p) weights in %.3lf ms\n", graph -> numberOfEdges, NowInMilliseconds() - start);
+    }
+    if (sourceId < 1 || sourceId > graph -> numberOfVertices || (targetId != -1 && (targetId < 1 || targetId > graph -> numberOfVertices)))
+    {
+        fprintf(stderr, "Source and target vertices must be between 1 and %d\n", graph -> numberOfVertices);
+        exit(-1);
+    }
+    if (isQueueFree && metric -> RunWithoutQueue == NULL)
+    {
+        fprintf(stderr, "Metric %s needs a priority queue\n", metric -> name);
+        exit(-1);
+    }
+    if (updateFileName != NULL && (isBidirectional || numberOfLandmarks > 0 || isHierarchical || delta >= 0.0 || queryFileName != NULL || matrixFileName != NULL || repetitions > 0 || isQueueFree))
+    {
+        fprintf(stderr, "Edge updates (-U) repair a single-source search on a priority queue and cannot be combined with -p, -L, -H, -d, -B, -A, -b or -q none\n");
+        exit(-1);
+    }
+    if (isCompact && (isBidirectional || numberOfLandmarks > 0 || isHierarchical || updateFileName != NULL || delta >= 0.0 || queryFileName != NULL || matrixFileName != NULL || isQueueFree))
+    {
+        fprintf(stderr, "Compact graphs (-E) answer single-source searches on a priority queue and cannot be combined with -p, -L, -H, -U, -d, -B, -A or -q none\n");
+        exit(-1);
+    }
+    if (isReordering && (isBidirectional || numberOfLandmarks > 0 || isHierarchical || updateFileName != NULL || queryFileName != NULL || matrixFileName != NULL))
+    {
+        fprintf(stderr, "Vertex orders (-V) apply to single-source searches and cannot be combined with -p, -L, -H, -U, -B or -A\n");
+        exit(-1);
+    }
+    if (isReordering && repetitions > 0)
+    {
+        if (isCompact || delta >= 0.0)
+        {
+            fprintf(stderr, "Comparing vertex orders (-V with -b) cannot be combined with -E or -d\n");
+            exit(-1);
+        }
+        if (queueBackend == NULL && metric -> RunWithoutQueue == NULL)
+            queueBackend = &BinaryHeapOperations;
+        BenchmarkOrders(graph, metric, queueBackend, sourceId, targetId, isLazy, repetitions);
+        DestroyGraph(graph);
+        DestroyThreadPool(pool);
+        return 0;
+    }
+    // The search runs on the relabeled graph; the input one stays for the vertex dump
+    struct Relabeling* relabeling = NULL;
+    struct Graph* originalGraph = NULL;
+    if (isReordering)
+    {
+        StartPhase(&phases, "relabel");
+        const double start = NowInMilliseconds();
+        relabeling = CreateRelabeling(graph, vertexOrder); // ! O(VlgV + E lg deg)
+        struct Graph* relabeledGraph = RelabelGraph(graph, relabeling); // ! O(V + E)
+        const double elapsed = NowInMilliseconds() - start;
+        int bandwidth;
+        const double originalGap = GetAverageEdgeGap(graph, &bandwidth);
+        const double relabeledGap = GetAverageEdgeGap(relabeledGraph, &bandwidth);
+        Report("Relabeled %d vertices in %s order (average edge gap %.1lf -> %.1lf) in %.3lf ms\n", graph -> numberOfVertices, vertexOrderName, originalGap, relabeledGap, elapsed);
+        if (isQuiet)
+            DestroyGraph(graph);
+        else
+            originalGraph = graph;
+        graph = relabeledGraph;
+        sourceId = relabeling -> newIds[sourceId - 1];
+        if (targetId != -1)
+            targetId = relabeling -> newIds[targetId - 1];
+    }
+    if (isBidirectional || numberOfLandmarks > 0 || isHierarchical)
+    {
+        if (targetId == -1 || delta >= 0.0 || queryFileName != NULL || matrixFileName != NULL)
+        {
+            fprintf(stderr, "Point-to-point searches (-p, -L, -H) need a target (-t) and cannot be combined with -d, -B or -A\n");
+            exit(-1);
+        }
+        if (isBidirectional + (numberOfLandmarks > 0) + isHierarchical > 1 && repetitions == 0)
+        {
+            fprintf(stderr, "Choose one of -p, -L and -H, or compare them with -b\n");
+            exit(-1);
+        }
+        if (numberOfLandmarks > 0 && metric -> RunAStar == NULL)
+        {
+            fprintf(stderr, "Metric %s has no landmark bounds (A* supports additive, reliability, hops)\n", metric -> name);
+            exit(-1);
+        }
+        if (isQueueFree)
+        {
+            fprintf(stderr, "Point-to-point searches need a priority queue\n");
+            exit(-1);
+        }
+        if (queueBackend == NULL)
+            queueBackend = &BinaryHeapOperations;
+        double start = NowInMilliseconds();
+        struct Graph* reverseGraph = CreateReverseGraph(graph); // ! O(V + E)
+        Report("Reversed %d edges in %.3lf ms\n", graph -> numberOfEdges, NowInMilliseconds() - start);
+        struct Landmarks* landmarks = NULL;
+        if (numberOfLandmarks > 0)
+        {
+            if (numberOfLandmarks > graph -> numberOfVertices)
+                numberOfLandmarks = graph -> numberOfVertices;
+            // The landmark tables are cached beside the graph, one sidecar file per metric
+            char* landmarksName = (char*) malloc(strlen(fileName) + strlen(metric -> name) + 6);
+            sprintf(landmarksName, "%s.%s.alt", fileName, metric -> name);
+            start = NowInMilliseconds();
+            landmarks = LoadLandmarks(landmarksName, graph, metric, numberOfLandmarks); // ! O(V + E + kV)
+            if (landmarks != NULL)
+                Report("Loaded %d landmarks from %s in %.3lf ms\n", numberOfLandmarks, landmarksName, NowInMilliseconds() - start);
+            else
+            {
+                landmarks = SelectLandmarks(graph, reverseGraph, metric, numberOfLandmarks, pool); // ! O(k (V + E)lgV)
+                // The sidecar is only a cache: if it cannot be written, the tables in memory still answer the query
+                if (WriteLandmarks(landmarks, graph, metric, landmarksName))
+                    Report("Selected %d landmarks and wrote %s in %.3lf ms\n", numberOfLandmarks, landmarksName, NowInMilliseconds() - start);
+                else
+                    Report("Selected %d landmarks in %.3lf ms; warning: cannot write %s\n", numberOfLandmarks, NowInMilliseconds() - start, landmarksName);
+            }
+            free(landmarksName);
+        }
+        struct ContractionHierarchy* hierarchy = NULL;
+        if (isHierarchical)
+        {
+            char* hierarchyName = (char*) malloc(strlen(fileName) + strlen(metric -> name) + 5);
+            sprintf(hierarchyName, "%s.%s.ch", fileName, metric -> name);
+            start = NowInMilliseconds();
+            hierarchy = LoadContractionHierarchy(hierarchyName, graph, metric); // ! O(V + E + shortcuts)
+            if (hierarchy != NULL)
+                Report("Loaded hierarchy %s (%d shortcuts) in %.3lf ms\n", hierarchyName, hierarchy -> numberOfShortcuts, NowInMilliseconds() - start);
+            else
+            {
+                hierarchy = BuildContractionHierarchy(graph, metric, pool);
+                // As with the landmarks, a sidecar that cannot be written leaves the hierarchy in memory to answer the query
+                if (WriteContractionHierarchy(hierarchy, graph, metric, hierarchyName))
+                    Report("Contracted %d vertices (%d shortcuts) on %d threads and wrote %s in %.3lf ms\n", graph -> numberOfVertices, hierarchy -> numberOfShortcuts, pool -> numberOfThreads, hierarchyName, NowInMilliseconds() - start);
+                else
+                    Report("Contracted %d vertices (%d shortcuts) on %d threads in %.3lf ms; warning: cannot write %s\n", graph -> numberOfVertices, hierarchy -> numberOfShortcuts, pool -> numberOfThreads, NowInMilliseconds() - start, hierarchyName);
+            }
+            free(hierarchyName);
+        }
+        if (repetitions > 0)
+            BenchmarkPointToPoint(graph, isBidirectional ? reverseGraph : NULL, landmarks, hierarchy, metric, queueBackend, sourceId, targetId, repetitions);
+        else
+            RunPointToPointQuery(graph, reverseGraph, landmarks, hierarchy, metric, queueBackend, sourceId, targetId);
+        if (landmarks != NULL)
+            DestroyLandmarks(landmarks);
+        if (hierarchy != NULL)
+            DestroyContractionHierarchy(hierarchy);
+        DestroyGraph(reverseGraph);
+        DestroyGraph(graph);
+        DestroyThreadPool(pool);
+        return 0;
+    }
+    if ((queryFileName != NULL || matrixFileName != NULL) && delta >= 0.0)
+    {
+        fprintf(stderr, "Batch and all-pairs queries run one per thread and cannot use delta-stepping\n");
+        exit(-1);
+    }
+    if ((queryFileName != NULL || matrixFileName != NULL) && queueBackend == NULL && metric -> RunWithoutQueue == NULL)
+        queueBackend = &BinaryHeapOperations;
+    if (matrixFileName != NULL)
+    {
+        if (lastSourceId == -1)
+            lastSourceId = graph -> numberOfVertices;
+        const double start = NowInMilliseconds();
+        WriteAllPairsMatrix(graph, metric, queueBackend, isLazy, firstSourceId, lastSourceId, matrixFormat, pool, matrixFileName);
+        Report("Wrote rows %d:%d of the %s matrix to %s on %d threads in %.3lf ms\n", firstSourceId, lastSourceId, metric -> name, matrixFileName, pool -> numberOfThreads, NowInMilliseconds() - start);
+        DestroyGraph(graph);
+        DestroyThreadPool(pool);
+        return 0;
+    }
+    if (queryFileName != NULL)
+    {
+        struct QueryList* queryList = ReadQueryFile(queryFileName); // ! O(queries)
+        const double start = NowInMilliseconds();
+        RunBatch(graph, metric, queueBackend, isLazy, queryList, pool, stdout);
+        Report("Answered %d queries on %d threads in %.3lf ms\n", queryList -> numberOfQueries, pool -> numberOfThreads, NowInMilliseconds() - start);
+        DestroyQueryList(queryList);
+        DestroyGraph(graph);
+        DestroyThreadPool(pool);
+        return 0;
+    }
+    struct DeltaStepping* deltaStepping = NULL;
+    if (delta >= 0.0)
+    {
+        if (strcmp(metric -> name, "additive") != 0)
+        {
+            fprintf(stderr, "Delta-stepping only supports the additive metric\n");
+            exit(-1);
+        }
+        StartPhase(&phases, "partition");
+        deltaStepping = CreateDeltaStepping(graph, pool, delta); // ! O(V + E)
+    }
+    struct CompactGraph* compactGraph = NULL;
+    if (isCompact)
+    {
+        if (queueBackend == NULL)
+            queueBackend = &BinaryHeapOperations;
+        if (repetitions > 0)
+        {
+            BenchmarkEncodings(graph, metric, queueBackend, sourceId, targetId, isLazy, repetitions);
+            DestroyGraph(graph);
+            DestroyThreadPool(pool);
+            return 0;
+        }
+        StartPhase(&phases, "encode");
+        const double start = NowInMilliseconds();
+        compactGraph = CreateCompactGraph(graph, weightEncoding); // ! O(V + E lg deg), O(E lgE) for uint16
+        const double csrMegabytes = GetGraphBytes(graph) / (1024.0 * 1024.0);
+        const double compactMegabytes = GetCompactGraphBytes(compactGraph) / (1024.0 * 1024.0);
+        if (weightEncoding == WEIGHTS_UINT16)
+            Report("Encoded %d edges with uint16 weights (%d codes, max error %lg) in %.3lf ms: %.2lf MB instead of %.2lf MB\n", graph -> numberOfEdges, compactGraph -> numberOfCodes, compactGraph -> maximumError, NowInMilliseconds() - start, compactMegabytes, csrMegabytes);
+        else
+            Report("Encoded %d edges with float32 weights (max error %lg) in %.3lf ms: %.2lf MB instead of %.2lf MB\n", graph -> numberOfEdges, compactGraph -> maximumError, NowInMilliseconds() - start, compactMegabytes, csrMegabytes);
+    }
+    if (repetitions > 0)
+    {
+        BenchmarkQueues(graph, metric, deltaStepping, sourceId, targetId, isLazy, repetitions);
+        if (deltaStepping != NULL)
+            DestroyDeltaStepping(deltaStepping);
+        DestroyGraph(graph);
+        DestroyThreadPool(pool);
+        return 0;
+    }
+    StartPhase(&phases, "initialize");
+    struct SearchState* state = CreateSearchStateForMetric(metric, graph -> numberOfVertices); // ! O(1)
+    // Without -q, metrics with a queue-free search (hops: BFS) use it, the others the binary heap
+    struct PriorityQueue* queue = NULL;
+    if (queueBackend == NULL && (metric -> RunWithoutQueue == NULL || updateFileName != NULL) && deltaStepping == NULL)
+        queueBackend = &BinaryHeapOperations;
+    if (queueBackend != NULL && deltaStepping == NULL)
+        queue = CreatePriorityQueue(queueBackend, graph -> numberOfVertices); // ! O(1)
+    if (compactGraph != NULL)
+    {
+        // The compact copy is all the search needs; keeping the CSR arrays would defeat it
+        DestroyGraph(graph); // ! O(1)
+        graph = NULL;
+    }
+
+    ResetSearchState(state, sourceId); // ! O(V)
+    InitializeMetricQuery(metric, state, queue, isLazy); // ! O(VlgV) eager, O(1) lazy
+    StartPhase(&phases, "search");
+    if (deltaStepping != NULL)
+    {
+        const double start = NowInMilliseconds();
+        RunDeltaStepping(deltaStepping, state, targetId); // ! O((V + E) / threads) per phase
+        Report("Delta-stepping: delta %lg, %d buckets, %d light phases, %d threads in %.3lf ms\n", deltaStepping -> delta, deltaStepping -> numberOfProcessedBuckets, deltaStepping -> numberOfPhases, pool -> numberOfThreads, NowInMilliseconds() - start);
+        DestroyDeltaStepping(deltaStepping);
+        deltaStepping = NULL;
+    }
+    else if (updateFileName != NULL)
+    {
+        // The repair needs the whole shortest-path tree, so this search ignores the target
+        RunInitializedQuery(metric, graph, state, queue, -1); // ! O((V + E)lgV)
+        StartPhase(&phases, "update");
+        struct UpdateList* updateList = ReadUpdateFile(updateFileName); // ! O(updates)
+        struct Graph* reverseGraph = CreateReverseGraph(graph); // ! O(V + E)
+        double start = NowInMilliseconds();
+        struct UpdateStatistics statistics;
+        ApplyEdgeUpdates(graph, reverseGraph, updateList, &statistics); // ! O(V + updates * deg), O(V + E) if edges come or go
+        Report("Applied %d updates (%d changed, %d inserted, %d deleted, %d missing) in %.3lf ms\n", updateList -> numberOfUpdates, statistics.numberOfChanged, statistics.numberOfInserted, statistics.numberOfDeleted, statistics.numberOfMissing, NowInMilliseconds() - start);
+        StartPhase(&phases, "repair");
+        start = NowInMilliseconds();
+        struct RepairResult repair;
+        metric -> RepairShortestPaths(graph, reverseGraph, state, queue, updateList -> updates, updateList -> numberOfUpdates, &repair); // ! O((affected + improved) * deg * lgV)
+        Report("Repaired the shortest-path tree: %d affected, %d settled of %d vertices in %.3lf ms\n", repair.numberOfAffected, repair.numberOfSettled, graph -> numberOfVertices, NowInMilliseconds() - start);
+        DestroyGraph(reverseGraph);
+        DestroyUpdateList(updateList);
+    }
+    else if (compactGraph != NULL)
+        metric -> RunCompactDijkstra(compactGraph, state, queue, targetId); // ! O((V + E)lgV)
+    else
+        RunInitializedQuery(metric, graph, state, queue, targetId); // ! O((V + E)lgV), O(V + E) without a queue
+    if (isLogSpace || relabeling != NULL)
+        StartPhase(&phases, "restore");
+    if (isLogSpace)
+        ConvertStateFromLogSpace(state, logScale); // ! O(V)
+    if (relabeling != NULL)
+    {
+        RestoreSearchState(state, relabeling); // ! O(V)
+        sourceId = relabeling -> oldIds[sourceId - 1];
+        if (targetId != -1)
+            targetId = relabeling -> oldIds[targetId - 1];
+    }
+    if (!isQuiet)
+        StartPhase(&phases, "print");
+    if (!isQuiet && originalGraph != NULL)
+        PrintGraph(originalGraph, state); // ! O(V + E)
+    else if (!isQuiet && compactGraph != NULL)
+        PrintCompactGraph(compactGraph, state); // ! O(V + E)
+    else if (!isQuiet)
+        PrintGraph(graph, state); // ! O(V + E)
+    if (pathFormat != PATHS_NONE)
+        StartPhase(&phases, "paths");
+    if (pathFormat == PATHS_LISTED)
+        FindMaximumReliabilityPaths(state, targetId); // ! O(V * depth)
+    else if (pathFormat == PATHS_PARENTS)
+        WriteParentArray(state, stdout); // ! O(V)
+    else if (pathFormat == PATHS_TREE)
+        WritePathTree(state, stdout); // ! O(V)
+    StartPhase(&phases, "write");
+    WriteResults(state, outputFormat, outputFileName); // ! O(V)
+    EndPhase(&phases);
+    if (reportFileName != NULL)
+    {
+        const int numberOfEdges = compactGraph != NULL ? compactGraph -> numberOfEdges : graph -> numberOfEdges;
+        WriteInstrumentReport(&phases, reportFileName, fileName, metricName, queue != NULL ? queueBackend -> name : NULL, state -> numberOfVertices, numberOfEdges); // ! O(phases)
+    }
+
+    if (queue != NULL)
+        DestroyPriorityQueue(queue); // ! O(1)
+    queue = NULL;
+    DestroySearchState(state); // ! O(1)
+    state = NULL;
+    if (compactGraph != NULL)
+        DestroyCompactGraph(compactGraph); // ! O(1)
+    compactGraph = NULL;
+    if (graph != NULL)
+        DestroyGraph(graph); // ! O(1)
+    graph = NULL;
+    if (originalGraph != NULL)
+        DestroyGraph(originalGraph); // ! O(1)
+    originalGraph = NULL;
+    if (relabeling != NULL)
+        DestroyRelabeling(relabeling); // ! O(1)
+    relabeling = NULL;
+    DestroyThreadPool(pool);
+    pool = NULL;
+    if (!isQuiet)
+        printf("Hello File %s\n", fileName);
+    return 0;
+}
\ No newline at end of file
@@ -1,210 +1,182 @@
 #include "MinPQ.h"
-#include "GraphA.h"
-#include "HelperA.h"
+#include "Search.h"
+#include "PriorityQueue.h"
 
 /**
- * @brief Create a MaxPQ object
+ * @brief Create a MinPQ object
  * ! Complexity: O(1)
  * @param capacity 
- * @return struct MaxPQ* 
+ * @return struct MinPQ* 
  */
-struct MaxPQ* CreateMaxPQ(const int capacity)
+struct MinPQ* CreateMinPQ(const int capacity)
 {
-    struct MaxPQ* queue = (struct MaxPQ*) malloc(sizeof(struct MaxPQ));
+    struct MinPQ* queue = (struct MinPQ*) malloc(sizeof(struct MinPQ));
     queue -> capacity = capacity;
     queue -> numberOfElements = 0;
-    queue -> maxHeap = (int*) malloc(capacity * sizeof(int));
+    queue -> minHeap = (int*) malloc(capacity * sizeof(int));
+    queue -> keys = (double*) malloc(capacity * sizeof(double));
     return queue;
 }
 
 /**
- * @brief Extract the maximum-key element from a MaxPQ object & restore heap property
+ * @brief Extract the minimum-key element from a MinPQ object & restore heap property
  * ! Complexity: O(lgV)
  * @param queue 
- * @param graph 
+ * @param state 
  * @return int 
  */
-int PQExtractMax(struct MaxPQ* queue, struct Graph* graph)
+int PQExtractMin(struct MinPQ* queue, struct SearchState* state)
 {
     int numberOfElements = queue -> numberOfElements;
-    int maxVertexId = -1;
+    int minVertexId = -1;
     if (numberOfElements > 0)
     {
-        maxVertexId = GetVertexOfHeapIndex(queue, 0);
-        queue -> maxHeap[0] = GetVertexOfHeapIndex(queue, numberOfElements - 1);
+        minVertexId = GetVertexOfHeapIndex(queue, 0);
+        queue -> minHeap[0] = GetVertexOfHeapIndex(queue, numberOfElements - 1);
+        queue -> keys[0] = GetKeyOfHeapIndex(queue, numberOfElements - 1);
         queue -> numberOfElements --;
-        graph -> adjacencyList[maxVertexId - 1].heapIndex = -1;
-        graph -> adjacencyList[queue -> maxHeap[0] - 1].heapIndex = 0;
-        MaxHeapify(queue, graph, 0); // ! O(lgV)
+        state -> heapIndices[minVertexId - 1] = SETTLED;
+        if (queue -> numberOfElements > 0)
+        {
+            state -> heapIndices[queue -> minHeap[0] - 1] = 0;
+            MinHeapify(queue, state, 0); // ! O(lgV)
+        }
     }
-    return maxVertexId;   
+    return minVertexId;   
 }
 
 /**
- * @brief Insert an element to a MaxPQ object & restore heap property
+ * @brief Insert an element to a MinPQ object & restore heap property.
+ * Keeps the heap indices of the inserted and the shifted vertices up to date.
  * ! Complexity: O(lgV)
  * @param queue 
- * @param graph 
+ * @param state 
  * @param vertexId 
+ * @param key 
  * @return int 
  */
-int PQInsert(struct MaxPQ* queue, struct Graph* graph, const int vertexId)
+int PQInsert(struct MinPQ* queue, struct SearchState* state, const int vertexId, const double key)
 {
     int index = -1;
     if (queue -> numberOfElements < queue -> capacity)
     {
         queue -> numberOfElements ++;
-        /*if (SINGLE_STEPPING)
-            printf("VERTEX ID: %d\n", vertexId);*/
-        const double key = GetKeyOfVertex(graph, vertexId);
-        /*if (SINGLE_STEPPING)
-            printf("KEY: %lf\n", key);*/
         index = queue -> numberOfElements - 1;
-
-        if (index > 0)
+        int parentIndex = Parent(index);
+        while (index > 0 && key < GetKeyOfHeapIndex(queue, parentIndex))
         {
-            int parentIndex = Parent(index);
-            double parentKey = GetKeyOfHeapIndex(queue, graph, parentIndex);
-            
-            while (index > 0 && key < parentKey)
-            {
-                //printf("INDEX: %d, PARENT ID: %d, PARENT KEY: %lf\n", index, parentIndex, parentKey);
-                queue -> maxHeap[index] = GetVertexOfHeapIndex(queue, parentIndex);
-                index = parentIndex;
-                parentIndex = Parent(index);
-                if (parentIndex >= 0)
-                    parentKey = GetKeyOfHeapIndex(queue, graph, parentIndex);
-            }
+            INSTRUMENT_COUNT(siftSteps);
+            queue -> minHeap[index] = GetVertexOfHeapIndex(queue, parentIndex);
+            queue -> keys[index] = GetKeyOfHeapIndex(queue, parentIndex);
+            state -> heapIndices[queue -> minHeap[index] - 1] = index;
+            index = parentIndex;
+            parentIndex = Parent(index);
         }
-        queue -> maxHeap[index] = vertexId;
+        queue -> minHeap[index] = vertexId;
+        queue -> keys[index] = key;
+        state -> heapIndices[vertexId - 1] = index;
+        MarkVertexTouched(state, vertexId);
     }
     return index;
 }
 
-int PQIncreaseKey(struct MaxPQ* queue, struct Graph* graph, int heapIndex, const double key)
+/**
+ * @brief Lower the key of the element at the given heap index & restore heap property
+ * ! Complexity: O(lgV)
+ * @param queue 
+ * @param state 
+ * @param heapIndex 
+ * @param key 
+ * @return int 0 on success, -1 if heapIndex is out of bounds, -2 if key is not smaller
+ */
+int PQDecreaseKey(struct MinPQ* queue, struct SearchState* state, int heapIndex, const double key)
 {
-    if (queue -> numberOfElements <= heapIndex)
+    if (heapIndex < 0 || queue -> numberOfElements <= heapIndex)
         return -1;
-    int graphIndex = queue -> maxHeap[heapIndex] - 1;
-    double currentKey = graph -> adjacencyList[graphIndex].weight;
-    if (SINGLE_STEPPING)
-        printf("HEAP INDEX:%d, VERTEX:%d, CURRENT KEY: %lf, KEY: %lf\n", heapIndex, graphIndex + 1, currentKey, key);
-    if (currentKey <= key)
+    int vertexId = queue -> minHeap[heapIndex];
+    if (GetKeyOfHeapIndex(queue, heapIndex) <= key)
         return -2;
-    if (heapIndex >= 0)
+    int parentIndex = Parent(heapIndex);
+    while (heapIndex > 0 && key < GetKeyOfHeapIndex(queue, parentIndex))
     {
-        if (heapIndex > 0)
-        {
-            int parentIndex = Parent(heapIndex);
-            double parentKey = GetKeyOfHeapIndex(queue, graph, parentIndex);
-            //printf("KEY:%lf MYKEY:%lf PARENT KEY:%lf\n", key, currentKey, parentKey);
-            while(heapIndex > 0 && key < parentKey)
-            {
-                queue -> maxHeap[heapIndex] = GetVertexOfHeapIndex(queue, parentIndex);
-                graph -> adjacencyList[queue -> maxHeap[heapIndex] - 1].heapIndex = heapIndex;
-                heapIndex = parentIndex;
-                parentIndex = Parent(heapIndex);
-                if (parentIndex >= 0)
-                    parentKey = GetKeyOfHeapIndex(queue, graph, parentIndex);
-            } 
-        }
-        
-        queue -> maxHeap[heapIndex] = graphIndex + 1;
-        graph -> adjacencyList[graphIndex].weight = key;
-        graph -> adjacencyList[graphIndex].heapIndex = heapIndex;
+        INSTRUMENT_COUNT(siftSteps);
+        queue -> minHeap[heapIndex] = GetVertexOfHeapIndex(queue, parentIndex);
+        queue -> keys[heapIndex] = GetKeyOfHeapIndex(queue, parentIndex);
+        state -> heapIndices[queue -> minHeap[heapIndex] - 1] = heapIndex;
+        heapIndex = parentIndex;
+        parentIndex = Parent(heapIndex);
     }
+    queue -> minHeap[heapIndex] = vertexId;
+    queue -> keys[heapIndex] = key;
+    state -> heapIndices[vertexId - 1] = heapIndex;
     return 0;
 }
 
-void PrintMaxPQ(struct MaxPQ* queue)
+void PrintMinPQ(struct MinPQ* queue)
 {
     printf("\nQueue - Number of Vertices: %d\n", queue -> numberOfElements);
     for (int index = 0 ; index < queue -> numberOfElements ; index++)
     {
-        printf("Index %d: Vertex %d\n", index, queue -> maxHeap[index]);
+        printf("Index %d: Vertex %d\n", index, queue -> minHeap[index]);
     }
 }
 
 /**
- * @brief Deallocate and destroy a MaxPQ object
+ * @brief Deallocate and destroy a MinPQ object
  * ! Complexity: O(1)
  * @param queue 
  */
-void DestroyMaxPQ(struct MaxPQ* queue)
+void DestroyMinPQ(struct MinPQ* queue)
 {
-    free(queue -> maxHeap);
-    queue -> maxHeap = NULL;
+    free(queue -> minHeap);
+    queue -> minHeap = NULL;
+    free(queue -> keys);
+    queue -> keys = NULL;
     free(queue);
 }
 
 /**
- * @brief Restore heap property of a MaxPQ object
+ * @brief Restore heap property of a MinPQ object by sifting the element at index down
  * ! Complexity: O(lgV)
  * @param queue 
- * @param graph 
+ * @param state 
  * @param index 
  */
-void MaxHeapify(struct MaxPQ* queue, struct Graph* graph, const int index)
+void MinHeapify(struct MinPQ* queue, struct SearchState* state, int index)
 {
     int numberOfElements = queue -> numberOfElements;
-
-    int maxHeapIndex = index;
-    double maxKey = GetKeyOfHeapIndex(queue, graph, maxHeapIndex);
-
-    int leftChildIndex = LeftChild(index);
-    int rightChildIndex = RightChild(index);
-    double leftChildKey, rightChildKey;
-    //printf("Left Child Index: %d, Left Child: %d, Right Child Index: %d, RightChild: %d\n", leftChildIndex, GetVertexOfHeapIndex(queue, leftChildIndex), rightChildIndex, GetVertexOfHeapIndex(queue, rightChildIndex));
-    //printf("Initial Max Index: %d, Max Value: %lf\n", maxHeapIndex, maxKey);
-    if (leftChildIndex < numberOfElements)
+    const int vertexId = GetVertexOfHeapIndex(queue, index);
+    const double key = GetKeyOfHeapIndex(queue, index);
+    while (true)
     {
-        leftChildKey = GetKeyOfHeapIndex(queue, graph, leftChildIndex);
-        //printf("Left Child Key: %lf\n", leftChildKey);
-        if (leftChildKey < maxKey)
+        int minHeapIndex = index;
+        double minKey = key;
+
+        int leftChildIndex = LeftChild(index);
+        int rightChildIndex = RightChild(index);
+        if (leftChildIndex < numberOfElements && GetKeyOfHeapIndex(queue, leftChildIndex) < minKey)
         {
-            
-            maxHeapIndex = leftChildIndex;
-            maxKey = leftChildKey;
+            minHeapIndex = leftChildIndex;
+            minKey = GetKeyOfHeapIndex(queue, leftChildIndex);
         }
-    }
-    //printf("After Left Max Index: %d, Max Value: %lf\n", maxHeapIndex, maxKey);
-    if (rightChildIndex < numberOfElements)
-    {
-        rightChildKey = GetKeyOfHeapIndex(queue, graph, rightChildIndex);
-        //printf("Right Child Key: %lf\n", rightChildKey);
-        if (rightChildKey < maxKey)
+        if (rightChildIndex < numberOfElements && GetKeyOfHeapIndex(queue, rightChildIndex) < minKey)
         {
-            maxHeapIndex = rightChildIndex;
-            maxKey = rightChildKey;
+            minHeapIndex = rightChildIndex;
+            minKey = GetKeyOfHeapIndex(queue, rightChildIndex);
         }
-    }
-    //printf("After Right Max Index: %d, Max Value: %lf\n", maxHeapIndex, maxKey);
-    if (maxHeapIndex != index)
-    {
-        // Update Heap Indices
-        int temp = GetVertexOfHeapIndex(queue, maxHeapIndex);
-        queue -> maxHeap[maxHeapIndex] = GetVertexOfHeapIndex(queue, index);
-        queue -> maxHeap[index] = temp;
+        if (minHeapIndex == index)
+            break;
 
-        graph -> adjacencyList[GetVertexOfHeapIndex(queue, index) - 1].heapIndex = index;
-        graph -> adjacencyList[GetVertexOfHeapIndex(queue, maxHeapIndex) - 1].heapIndex = maxHeapIndex;
-        //printf("IN MAXHEAPIFY:\n");
-        //PrintGraph(graph);
-        MaxHeapify(queue, graph, maxHeapIndex);
+        // Move the smaller child up and update its heap index
+        INSTRUMENT_COUNT(siftSteps);
+        queue -> minHeap[index] = GetVertexOfHeapIndex(queue, minHeapIndex);
+        queue -> keys[index] = minKey;
+        state -> heapIndices[queue -> minHeap[index] - 1] = index;
+        index = minHeapIndex;
     }
-}
-
-/**
- * @brief Get key-value of a vertex
- * ! Complexity: O(1)
- * @param graph 
- * @param vertexId 
- * @return int 
- */
-double GetKeyOfVertex(struct Graph* graph, const int vertexId)
-{
-    int graphIndex = vertexId - 1;
-    return graph -> adjacencyList[graphIndex].weight;
+    queue -> minHeap[index] = vertexId;
+    queue -> keys[index] = key;
+    state -> heapIndices[vertexId - 1] = index;
 }
 
 /**
@@ -214,22 +186,21 @@ double GetKeyOfVertex(struct Graph* graph, const int vertexId)
  * @param heapIndex 
  * @return int 
  */
-int GetVertexOfHeapIndex(struct MaxPQ* queue, const int heapIndex)
+int GetVertexOfHeapIndex(struct MinPQ* queue, const int heapIndex)
 {
-    return queue -> maxHeap[heapIndex];
+    return queue -> minHeap[heapIndex];
 }
 
 /**
  * @brief Get key-value of the vertex at the given heap-index
  * ! Complexity: O(1)
  * @param queue 
- * @param graph 
  * @param heapIndex 
- * @return int 
+ * @return double 
  */
-double GetKeyOfHeapIndex(struct MaxPQ* queue, struct Graph* graph, const int heapIndex)
+double GetKeyOfHeapIndex(struct MinPQ* queue, const int heapIndex)
 {
-    return GetKeyOfVertex(graph, GetVertexOfHeapIndex(queue, heapIndex));
+    return queue -> keys[heapIndex];
 }
 
 /**
@@ -240,7 +211,7 @@ double GetKeyOfHeapIndex(struct MaxPQ* queue, struct Graph* graph, const int hea
  */
 int Parent(const int index)
 {
-    return floor(((double) index - 1) / 2.0);
+    return index > 0 ? (index - 1) / 2 : -1;
 }
 
 /**
@@ -263,4 +234,57 @@ int LeftChild(const int index)
 int RightChild(const int index)
 {
     return 2 * (index + 1);
-}
\ No newline at end of file
+}
+
+// Backend Adapter:
+static void* BinaryHeapCreate(const int capacity)
+{
+    return CreateMinPQ(capacity);
+}
+
+static void BinaryHeapClear(void* queue)
+{
+    ((struct MinPQ*) queue) -> numberOfElements = 0;
+}
+
+static int BinaryHeapSize(const void* queue)
+{
+    return ((const struct MinPQ*) queue) -> numberOfElements;
+}
+
+static int BinaryHeapInsert(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    return PQInsert((struct MinPQ*) queue, state, vertexId, key);
+}
+
+static int BinaryHeapExtractMin(void* queue, struct SearchState* state)
+{
+    return PQExtractMin((struct MinPQ*) queue, state);
+}
+
+static int BinaryHeapDecreaseKey(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    return PQDecreaseKey((struct MinPQ*) queue, state, state -> heapIndices[vertexId - 1], key);
+}
+
+static void BinaryHeapPrint(const void* queue)
+{
+    PrintMinPQ((struct MinPQ*) queue);
+}
+
+static void BinaryHeapDestroy(void* queue)
+{
+    DestroyMinPQ((struct MinPQ*) queue);
+}
+
+const struct QueueOperations BinaryHeapOperations = {
+    "binary",
+    BinaryHeapCreate,
+    BinaryHeapClear,
+    BinaryHeapSize,
+    BinaryHeapInsert,
+    BinaryHeapExtractMin,
+    BinaryHeapDecreaseKey,
+    BinaryHeapPrint,
+    BinaryHeapDestroy
+};
\ No newline at end of file
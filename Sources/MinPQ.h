@@ -1,39 +1,37 @@
-#ifndef __MAXPQ_H__
-#define __MAXPQ_H__
-#include "GraphA.h"
+#ifndef __MINPQ_H__
+#define __MINPQ_H__
+#include "Search.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
-#include <math.h>
 
 
-struct MaxPQ {
+struct MinPQ {
     int numberOfElements;
     int capacity;
-    int* maxHeap;
+    int* minHeap;
+    double* keys;
 };
 
-struct MaxPQ* CreateMaxPQ(const int capacity);
+struct MinPQ* CreateMinPQ(const int capacity);
 
-int PQExtractMax(struct MaxPQ* queue, struct Graph* graph);
+int PQExtractMin(struct MinPQ* queue, struct SearchState* state);
 
-int PQInsert(struct MaxPQ* queue, struct Graph* graph, const int vertexId);
+int PQInsert(struct MinPQ* queue, struct SearchState* state, const int vertexId, const double key);
 
-int PQIncreaseKey(struct MaxPQ* queue, struct Graph* graph, int index, const double key);
+int PQDecreaseKey(struct MinPQ* queue, struct SearchState* state, int heapIndex, const double key);
 
-void PrintMaxPQ(struct MaxPQ* queue);
+void PrintMinPQ(struct MinPQ* queue);
 
-void DestroyMaxPQ(struct MaxPQ* queue);
+void DestroyMinPQ(struct MinPQ* queue);
 
 
 
-void MaxHeapify(struct MaxPQ* queue, struct Graph* graph, const int index);
+void MinHeapify(struct MinPQ* queue, struct SearchState* state, int index);
 
-double GetKeyOfVertex(struct Graph* graph, const int vertexId);
+int GetVertexOfHeapIndex(struct MinPQ* queue, const int heapIndex);
 
-int GetVertexOfHeapIndex(struct MaxPQ* queue, const int heapIndex);
-
-double GetKeyOfHeapIndex(struct MaxPQ* queue, struct Graph* graph, const int heapIndex);
+double GetKeyOfHeapIndex(struct MinPQ* queue, const int heapIndex);
 
 int Parent(const int index);
 
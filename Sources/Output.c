@@ -0,0 +1,226 @@
+#include "Output.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+// Bytes formatted in memory between two writes to the file
+#define OUTPUT_BUFFER_SIZE (1 << 20)
+// Room for the longest CSV row: two ids, a weight and the separators
+#define ROW_TEXT_SIZE (2 * INTEGER_TEXT_SIZE + WEIGHT_TEXT_SIZE + 4)
+// Below 2^52 / 10^8 a weight in units of 10^-8 keeps its halves exact, so it rounds like printf
+#define FAST_FORMAT_LIMIT 4.5e7
+
+/**
+ * Results are formatted into one large buffer that is written out whenever
+ * the next entry might not fit, so the file sees few large writes however
+ * many vertices there are.
+ */
+struct OutputBuffer {
+    FILE* file;
+    size_t size;
+    char* bytes;
+};
+
+// Private Methods:
+static void FlushOutput(struct OutputBuffer* buffer)
+{
+    if (buffer -> size > 0 && fwrite(buffer -> bytes, 1, buffer -> size, buffer -> file) != buffer -> size)
+    {
+        fprintf(stderr, "Cannot write the results\n");
+        exit(-1);
+    }
+    buffer -> size = 0;
+}
+
+// Room for length more bytes at the end of the buffer
+static char* ReserveOutput(struct OutputBuffer* buffer, const size_t length)
+{
+    if (buffer -> size + length > OUTPUT_BUFFER_SIZE)
+        FlushOutput(buffer);
+    return buffer -> bytes + buffer -> size;
+}
+
+static bool IsReached(const struct SearchState* state, const int index)
+{
+    // Vertices left in the queue by an early-terminated search are unsettled
+    return state -> weights[index] != state -> unreachableWeight && state -> heapIndices[index] == SETTLED;
+}
+
+// Public Methods:
+/**
+ * @brief Parse an output format name: text, binary or csv
+ * ! Complexity: O(1)
+ * @param name 
+ * @param format 
+ * @return true if the name is known
+ */
+bool ParseOutputFormat(const char* name, enum OutputFormat* format)
+{
+    if (strcmp(name, "text") == 0)
+        *format = OUTPUT_TEXT;
+    else if (strcmp(name, "binary") == 0)
+        *format = OUTPUT_BINARY;
+    else if (strcmp(name, "csv") == 0)
+        *format = OUTPUT_CSV;
+    else
+        return false;
+    return true;
+}
+
+/**
+ * @brief Format an integer in decimal without going through printf. The text is not
+ * terminated and needs room for INTEGER_TEXT_SIZE characters.
+ * ! Complexity: O(1)
+ * @param text 
+ * @param value 
+ * @return the length of the text
+ */
+int FormatInteger(char* text, const int value)
+{
+    char digits[12];
+    int count = 0, length = 0;
+    unsigned int rest = value < 0 ? 0u - (unsigned int) value : (unsigned int) value;
+    do
+    {
+        digits[count++] = '0' + rest % 10;
+        rest /= 10;
+    } while (rest > 0);
+    if (value < 0)
+        text[length++] = '-';
+    while (count > 0)
+        text[length++] = digits[--count];
+    return length;
+}
+
+/**
+ * @brief Format a weight exactly as printf("%0.8lf") does, without going through printf
+ * for the usual magnitudes: the weight is scaled to an integer number of 10^-8 units and
+ * its digits are written directly. text needs room for WEIGHT_TEXT_SIZE characters.
+ * ! Complexity: O(1)
+ * @param text 
+ * @param weight 
+ * @return the length of the text, terminator excluded
+ */
+int FormatWeight(char* text, const double weight)
+{
+    // Infinite, NaN and huge weights are rare enough to leave to printf
+    if (!(fabs(weight) < FAST_FORMAT_LIMIT))
+        return snprintf(text, WEIGHT_TEXT_SIZE, "%0.8lf", weight);
+    const double scaled = weight * 1e8;
+    double rounded = nearbyint(scaled); // ties to even, as printf rounds exact halves
+    if (fabs(scaled - rounded) == 0.5)
+    {
+        // The product itself may have been rounded onto a half: its exact error tells
+        // on which side of the half weight * 10^8 really is
+        const double error = fma(weight, 1e8, -scaled);
+        if (error != 0.0)
+            rounded = error > 0.0 ? ceil(scaled) : floor(scaled);
+    }
+    const uint64_t units = (uint64_t) fabs(rounded);
+    uint64_t whole = units / 100000000, fraction = units % 100000000;
+    char digits[20];
+    int count = 0, length = 0;
+    do
+    {
+        digits[count++] = '0' + whole % 10;
+        whole /= 10;
+    } while (whole > 0);
+    // printf keeps the sign of negative weights that round to zero
+    if (signbit(weight))
+        text[length++] = '-';
+    while (count > 0)
+        text[length++] = digits[--count];
+    text[length++] = '.';
+    for (int position = 7 ; position >= 0 ; position--)
+    {
+        text[length + position] = '0' + fraction % 10;
+        fraction /= 10;
+    }
+    length += 8;
+    text[length] = '\0';
+    return length;
+}
+
+/**
+ * @brief Write the final weight of every vertex, and for binary and csv its previous
+ * vertex, to a file in the given format (see OutputFormat), "-" for stdout
+ * ! Complexity: O(V)
+ * @param state 
+ * @param format 
+ * @param fileName 
+ */
+void WriteResults(const struct SearchState* state, const enum OutputFormat format, const char* fileName)
+{
+    const bool isStandardOutput = strcmp(fileName, "-") == 0;
+    struct OutputBuffer buffer;
+    buffer.file = isStandardOutput ? stdout : fopen(fileName, format == OUTPUT_BINARY ? "wb" : "w");
+    if (buffer.file == NULL)
+    {
+        fprintf(stderr, "Cannot open file %s\n", fileName);
+        exit(-1);
+    }
+    buffer.size = 0;
+    buffer.bytes = (char*) malloc(OUTPUT_BUFFER_SIZE);
+    if (format == OUTPUT_TEXT)
+    {
+        for (int index = 0 ; index < state -> numberOfVertices ; index++)
+        {
+            char* text = ReserveOutput(&buffer, WEIGHT_TEXT_SIZE + 1);
+            int length;
+            if (IsReached(state, index))
+                length = FormatWeight(text, state -> weights[index]);
+            else
+            {
+                memcpy(text, "-1", 2);
+                length = 2;
+            }
+            text[length++] = '\n';
+            buffer.size += length;
+        }
+    }
+    else if (format == OUTPUT_CSV)
+    {
+        memcpy(ReserveOutput(&buffer, 23), "vertex,weight,previous\n", 23);
+        buffer.size += 23;
+        for (int index = 0 ; index < state -> numberOfVertices ; index++)
+        {
+            char* text = ReserveOutput(&buffer, ROW_TEXT_SIZE);
+            const bool isReached = IsReached(state, index);
+            int length = FormatInteger(text, index + 1);
+            text[length++] = ',';
+            if (isReached)
+                length += FormatWeight(text + length, state -> weights[index]);
+            else
+                length += FormatInteger(text + length, -1);
+            text[length++] = ',';
+            length += FormatInteger(text + length, isReached ? state -> previousVertexIds[index] : -1);
+            text[length++] = '\n';
+            buffer.size += length;
+        }
+    }
+    else
+    {
+        for (int index = 0 ; index < state -> numberOfVertices ; index++)
+        {
+            const double weight = IsReached(state, index) ? state -> weights[index] : -1.0;
+            memcpy(ReserveOutput(&buffer, sizeof(double)), &weight, sizeof(double));
+            buffer.size += sizeof(double);
+        }
+        for (int index = 0 ; index < state -> numberOfVertices ; index++)
+        {
+            const int32_t previousVertexId = IsReached(state, index) ? state -> previousVertexIds[index] : -1;
+            memcpy(ReserveOutput(&buffer, sizeof(int32_t)), &previousVertexId, sizeof(int32_t));
+            buffer.size += sizeof(int32_t);
+        }
+    }
+    FlushOutput(&buffer);
+    free(buffer.bytes);
+    if (isStandardOutput)
+        fflush(stdout);
+    else if (fclose(buffer.file) != 0)
+    {
+        fprintf(stderr, "Cannot write file %s\n", fileName);
+        exit(-1);
+    }
+}
\ No newline at end of file
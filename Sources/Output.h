@@ -0,0 +1,36 @@
+#ifndef __OUTPUT_H__
+#define __OUTPUT_H__
+#include "Search.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+// Longest text FormatWeight produces, terminator included ("%0.8lf" of DBL_MAX)
+#define WEIGHT_TEXT_SIZE 328
+// Longest text FormatInteger produces ("-2147483648"), which adds no terminator
+#define INTEGER_TEXT_SIZE 11
+
+/**
+ * Result file of a single-source search, one entry per vertex in id order:
+ * - text: the weight with 8 decimals ("%0.8lf"), or -1 for unreachable and
+ *   unsettled vertices, one per line (the fill-file format)
+ * - binary: V native-endian float64 weights (-1 as in text), then V int32
+ *   previous-vertex ids (-1 for unreached vertices), no header
+ * - csv: a "vertex,weight,previous" header, then one row per vertex
+ * A file name of "-" writes to stdout.
+ */
+enum OutputFormat {
+    OUTPUT_TEXT,
+    OUTPUT_BINARY,
+    OUTPUT_CSV
+};
+
+// Public Methods:
+bool ParseOutputFormat(const char* name, enum OutputFormat* format);
+
+int FormatInteger(char* text, const int value);
+
+int FormatWeight(char* text, const double weight);
+
+void WriteResults(const struct SearchState* state, const enum OutputFormat format, const char* fileName);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "PriorityQueue.h"
+#include "Search.h"
+
+/**
+ * Pairing heap over vertex ids with O(1) insert and decrease-key and
+ * O(lgV) amortized extract. Nodes are preallocated per vertex and linked
+ * by index (0 means none); prev is the parent for a leftmost child and the
+ * left sibling otherwise.
+ */
+struct PairingHeap {
+    int numberOfElements;
+    int capacity;
+    int root;
+    double* keys;
+    int* child;
+    int* sibling;
+    int* prev;
+    int* roots;
+};
+
+// Private Methods:
+/**
+ * @brief Link two detached trees, making the larger root the leftmost child of the smaller one
+ * ! Complexity: O(1)
+ */
+static inline int Link(struct PairingHeap* heap, int first, int second)
+{
+    if (first == 0)
+        return second;
+    if (second == 0)
+        return first;
+    INSTRUMENT_COUNT(siftSteps);
+    if (heap -> keys[second] < heap -> keys[first])
+    {
+        int temp = first;
+        first = second;
+        second = temp;
+    }
+    heap -> sibling[second] = heap -> child[first];
+    if (heap -> child[first] != 0)
+        heap -> prev[heap -> child[first]] = second;
+    heap -> prev[second] = first;
+    heap -> child[first] = second;
+    return first;
+}
+
+/**
+ * @brief Detach a non-root node (and its subtree) from its parent and siblings
+ * ! Complexity: O(1)
+ */
+static inline void Cut(struct PairingHeap* heap, const int node)
+{
+    const int prev = heap -> prev[node];
+    if (heap -> child[prev] == node)
+        heap -> child[prev] = heap -> sibling[node];
+    else
+        heap -> sibling[prev] = heap -> sibling[node];
+    if (heap -> sibling[node] != 0)
+        heap -> prev[heap -> sibling[node]] = prev;
+    heap -> sibling[node] = 0;
+    heap -> prev[node] = 0;
+}
+
+/**
+ * @brief Two-pass merge of a sibling list: pair left to right, then fold right to left
+ * ! Complexity: O(lgV) amortized
+ */
+static int MergePairs(struct PairingHeap* heap, int first)
+{
+    int numberOfRoots = 0;
+    while (first != 0)
+    {
+        int second = heap -> sibling[first];
+        int next = second != 0 ? heap -> sibling[second] : 0;
+        heap -> sibling[first] = heap -> prev[first] = 0;
+        if (second != 0)
+            heap -> sibling[second] = heap -> prev[second] = 0;
+        heap -> roots[numberOfRoots ++] = Link(heap, first, second);
+        first = next;
+    }
+    int root = 0;
+    for (int index = numberOfRoots - 1 ; index >= 0 ; index--)
+        root = Link(heap, heap -> roots[index], root);
+    return root;
+}
+
+// Backend Adapters:
+static void* PairingHeapCreate(const int capacity)
+{
+    struct PairingHeap* heap = (struct PairingHeap*) malloc(sizeof(struct PairingHeap));
+    heap -> numberOfElements = 0;
+    heap -> capacity = capacity;
+    heap -> root = 0;
+    heap -> keys = (double*) malloc((capacity + 1) * sizeof(double));
+    heap -> child = (int*) malloc((capacity + 1) * sizeof(int));
+    heap -> sibling = (int*) malloc((capacity + 1) * sizeof(int));
+    heap -> prev = (int*) malloc((capacity + 1) * sizeof(int));
+    heap -> roots = (int*) malloc((capacity + 1) * sizeof(int));
+    return heap;
+}
+
+static void PairingHeapClear(void* queue)
+{
+    struct PairingHeap* heap = (struct PairingHeap*) queue;
+    heap -> numberOfElements = 0;
+    heap -> root = 0;
+}
+
+static int PairingHeapSize(const void* queue)
+{
+    return ((const struct PairingHeap*) queue) -> numberOfElements;
+}
+
+static int PairingHeapInsert(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    struct PairingHeap* heap = (struct PairingHeap*) queue;
+    if (heap -> numberOfElements >= heap -> capacity)
+        return -1;
+    heap -> numberOfElements ++;
+    heap -> keys[vertexId] = key;
+    heap -> child[vertexId] = heap -> sibling[vertexId] = heap -> prev[vertexId] = 0;
+    heap -> root = Link(heap, heap -> root, vertexId);
+    state -> heapIndices[vertexId - 1] = 0;
+    MarkVertexTouched(state, vertexId);
+    return 0;
+}
+
+static int PairingHeapExtractMin(void* queue, struct SearchState* state)
+{
+    struct PairingHeap* heap = (struct PairingHeap*) queue;
+    if (heap -> numberOfElements == 0)
+        return -1;
+    const int minVertexId = heap -> root;
+    heap -> numberOfElements --;
+    heap -> root = MergePairs(heap, heap -> child[minVertexId]);
+    heap -> child[minVertexId] = 0;
+    state -> heapIndices[minVertexId - 1] = SETTLED;
+    return minVertexId;
+}
+
+static int PairingHeapDecreaseKey(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    struct PairingHeap* heap = (struct PairingHeap*) queue;
+    if (state -> heapIndices[vertexId - 1] < 0)
+        return -1;
+    if (!(key < heap -> keys[vertexId]))
+        return -2;
+    heap -> keys[vertexId] = key;
+    if (vertexId != heap -> root)
+    {
+        Cut(heap, vertexId);
+        heap -> root = Link(heap, heap -> root, vertexId);
+    }
+    return 0;
+}
+
+static void PairingHeapPrint(const void* queue)
+{
+    const struct PairingHeap* heap = (const struct PairingHeap*) queue;
+    printf("\nQueue - Number of Vertices: %d, Root: Vertex %d\n", heap -> numberOfElements, heap -> root);
+}
+
+static void PairingHeapDestroy(void* queue)
+{
+    struct PairingHeap* heap = (struct PairingHeap*) queue;
+    free(heap -> keys);
+    free(heap -> child);
+    free(heap -> sibling);
+    free(heap -> prev);
+    free(heap -> roots);
+    free(heap);
+}
+
+const struct QueueOperations PairingHeapOperations = {
+    "pairing",
+    PairingHeapCreate,
+    PairingHeapClear,
+    PairingHeapSize,
+    PairingHeapInsert,
+    PairingHeapExtractMin,
+    PairingHeapDecreaseKey,
+    PairingHeapPrint,
+    PairingHeapDestroy
+};
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "PriorityQueue.h"
+#include <string.h>
+
+const struct QueueOperations* const QUEUE_BACKENDS[] = {
+    &BinaryHeapOperations,
+    &Dary4HeapOperations,
+    &Dary8HeapOperations,
+    &PairingHeapOperations,
+    &RadixHeapOperations
+};
+
+const int NUMBER_OF_QUEUE_BACKENDS = sizeof(QUEUE_BACKENDS) / sizeof(QUEUE_BACKENDS[0]);
+
+// Public Methods:
+/**
+ * @brief Look up a priority-queue backend by name
+ * ! Complexity: O(1)
+ * @param name 
+ * @return const struct QueueOperations* (NULL if there is no such backend)
+ */
+const struct QueueOperations* FindQueueBackend(const char* name)
+{
+    for (int index = 0 ; index < NUMBER_OF_QUEUE_BACKENDS ; index++)
+    {
+        if (strcmp(QUEUE_BACKENDS[index] -> name, name) == 0)
+            return QUEUE_BACKENDS[index];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Create a PriorityQueue object using the given backend
+ * ! Complexity: O(1)
+ * @param operations 
+ * @param capacity 
+ * @return struct PriorityQueue* 
+ */
+struct PriorityQueue* CreatePriorityQueue(const struct QueueOperations* operations, const int capacity)
+{
+    struct PriorityQueue* queue = (struct PriorityQueue*) malloc(sizeof(struct PriorityQueue));
+    queue -> operations = operations;
+    queue -> queue = operations -> Create(capacity);
+    return queue;
+}
+
+/**
+ * @brief Deallocate and destroy a PriorityQueue object
+ * ! Complexity: O(1)
+ * @param queue 
+ */
+void DestroyPriorityQueue(struct PriorityQueue* queue)
+{
+    queue -> operations -> Destroy(queue -> queue);
+    queue -> queue = NULL;
+    free(queue);
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifndef __PRIORITYQUEUE_H__
+#define __PRIORITYQUEUE_H__
+#include "Search.h"
+#include "Instrument.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/**
+ * Interface every priority-queue backend implements: a min-queue of vertex
+ * ids keyed by doubles that the caller passes in (the search engine turns
+ * its metric's weights into keys, see Semiring.h). Backends keep
+ * state -> heapIndices non-negative while a vertex is queued and set it to
+ * SETTLED when it is extracted.
+ */
+struct QueueOperations {
+    const char* name;
+    void* (*Create)(const int capacity);
+    void (*Clear)(void* queue);
+    int (*Size)(const void* queue);
+    int (*Insert)(void* queue, struct SearchState* state, const int vertexId, const double key);
+    int (*ExtractMin)(void* queue, struct SearchState* state);
+    int (*DecreaseKey)(void* queue, struct SearchState* state, const int vertexId, const double key);
+    void (*Print)(const void* queue);
+    void (*Destroy)(void* queue);
+};
+
+struct PriorityQueue {
+    const struct QueueOperations* operations;
+    void* queue;
+};
+
+// Backends:
+extern const struct QueueOperations BinaryHeapOperations;
+extern const struct QueueOperations Dary4HeapOperations;
+extern const struct QueueOperations Dary8HeapOperations;
+extern const struct QueueOperations PairingHeapOperations;
+extern const struct QueueOperations RadixHeapOperations;
+
+extern const struct QueueOperations* const QUEUE_BACKENDS[];
+extern const int NUMBER_OF_QUEUE_BACKENDS;
+
+// Public Methods:
+const struct QueueOperations* FindQueueBackend(const char* name);
+
+struct PriorityQueue* CreatePriorityQueue(const struct QueueOperations* operations, const int capacity);
+
+void DestroyPriorityQueue(struct PriorityQueue* queue);
+
+static inline void QueueClear(struct PriorityQueue* queue)
+{
+    queue -> operations -> Clear(queue -> queue);
+}
+
+static inline int QueueSize(const struct PriorityQueue* queue)
+{
+    return queue -> operations -> Size(queue -> queue);
+}
+
+static inline int QueueInsert(struct PriorityQueue* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    INSTRUMENT_COUNT(inserts);
+    return queue -> operations -> Insert(queue -> queue, state, vertexId, key);
+}
+
+static inline int QueueExtractMin(struct PriorityQueue* queue, struct SearchState* state)
+{
+    INSTRUMENT_COUNT(extracts);
+    return queue -> operations -> ExtractMin(queue -> queue, state);
+}
+
+static inline int QueueDecreaseKey(struct PriorityQueue* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    INSTRUMENT_COUNT(decreaseKeys);
+    return queue -> operations -> DecreaseKey(queue -> queue, state, vertexId, key);
+}
+
+static inline void QueuePrint(const struct PriorityQueue* queue)
+{
+    queue -> operations -> Print(queue -> queue);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,198 @@
+#include "PriorityQueue.h"
+#include "Search.h"
+#include <stdint.h>
+#include <string.h>
+
+#define NUMBER_OF_BUCKETS 65
+
+/**
+ * Radix heap (monotone priority queue). Keys are ranked by their IEEE-754
+ * bits: flipping the sign bit of a non-negative double and complementing a
+ * negative one gives an unsigned integer that orders the same way as the
+ * double itself, so no integer quantization is needed. Bucket i > 0 holds the ranks whose
+ * highest bit differing from the last extracted rank is bit i - 1; buckets
+ * are doubly linked lists threaded through per-vertex arrays (0 means none).
+ * Dijkstra's keys never get better than the last extracted key, which is
+ * all the radix heap requires.
+ */
+struct RadixHeap {
+    int numberOfElements;
+    int capacity;
+    uint64_t lastRank;
+    uint64_t* ranks;
+    int* next;
+    int* prev;
+    int buckets[NUMBER_OF_BUCKETS];
+};
+
+// Private Methods:
+static inline uint64_t KeyToRank(const double key)
+{
+    uint64_t bits;
+    const double normalizedKey = key + 0.0; // -0.0 ranks with 0.0
+    memcpy(&bits, &normalizedKey, sizeof(bits));
+    return (bits >> 63) ? ~bits : bits ^ (UINT64_C(1) << 63);
+}
+
+static inline int BucketOf(const struct RadixHeap* heap, const uint64_t rank)
+{
+    return rank == heap -> lastRank ? 0 : 64 - __builtin_clzll(rank ^ heap -> lastRank);
+}
+
+static inline void PushToBucket(struct RadixHeap* heap, struct SearchState* state, const int vertexId)
+{
+    const int bucket = BucketOf(heap, heap -> ranks[vertexId]);
+    heap -> prev[vertexId] = 0;
+    heap -> next[vertexId] = heap -> buckets[bucket];
+    if (heap -> buckets[bucket] != 0)
+        heap -> prev[heap -> buckets[bucket]] = vertexId;
+    heap -> buckets[bucket] = vertexId;
+    state -> heapIndices[vertexId - 1] = bucket;
+}
+
+static inline void RemoveFromBucket(struct RadixHeap* heap, struct SearchState* state, const int vertexId)
+{
+    const int bucket = state -> heapIndices[vertexId - 1];
+    if (heap -> prev[vertexId] != 0)
+        heap -> next[heap -> prev[vertexId]] = heap -> next[vertexId];
+    else
+        heap -> buckets[bucket] = heap -> next[vertexId];
+    if (heap -> next[vertexId] != 0)
+        heap -> prev[heap -> next[vertexId]] = heap -> prev[vertexId];
+}
+
+static void CheckMonotone(const struct RadixHeap* heap, const uint64_t rank, const int vertexId)
+{
+    if (rank < heap -> lastRank)
+    {
+        fprintf(stderr, "Radix heap needs monotone keys: vertex %d got a key smaller than the last extracted one\n", vertexId);
+        exit(-1);
+    }
+}
+
+// Backend Adapters:
+static void* RadixHeapCreate(const int capacity)
+{
+    struct RadixHeap* heap = (struct RadixHeap*) malloc(sizeof(struct RadixHeap));
+    heap -> numberOfElements = 0;
+    heap -> capacity = capacity;
+    heap -> lastRank = 0;
+    heap -> ranks = (uint64_t*) malloc((capacity + 1) * sizeof(uint64_t));
+    heap -> next = (int*) malloc((capacity + 1) * sizeof(int));
+    heap -> prev = (int*) malloc((capacity + 1) * sizeof(int));
+    memset(heap -> buckets, 0, sizeof(heap -> buckets));
+    return heap;
+}
+
+static void RadixHeapClear(void* queue)
+{
+    struct RadixHeap* heap = (struct RadixHeap*) queue;
+    heap -> numberOfElements = 0;
+    heap -> lastRank = 0;
+    memset(heap -> buckets, 0, sizeof(heap -> buckets));
+}
+
+static int RadixHeapSize(const void* queue)
+{
+    return ((const struct RadixHeap*) queue) -> numberOfElements;
+}
+
+static int RadixHeapInsert(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    struct RadixHeap* heap = (struct RadixHeap*) queue;
+    if (heap -> numberOfElements >= heap -> capacity)
+        return -1;
+    const uint64_t rank = KeyToRank(key);
+    CheckMonotone(heap, rank, vertexId);
+    heap -> numberOfElements ++;
+    heap -> ranks[vertexId] = rank;
+    PushToBucket(heap, state, vertexId);
+    MarkVertexTouched(state, vertexId);
+    return state -> heapIndices[vertexId - 1];
+}
+
+static int RadixHeapExtractMin(void* queue, struct SearchState* state)
+{
+    struct RadixHeap* heap = (struct RadixHeap*) queue;
+    if (heap -> numberOfElements == 0)
+        return -1;
+    if (heap -> buckets[0] == 0)
+    {
+        // Find the first non-empty bucket and redistribute it around its minimum rank
+        int bucket = 1;
+        while (heap -> buckets[bucket] == 0)
+            bucket++;
+        uint64_t minRank = UINT64_MAX;
+        for (int vertexId = heap -> buckets[bucket] ; vertexId != 0 ; vertexId = heap -> next[vertexId])
+        {
+            if (heap -> ranks[vertexId] < minRank)
+                minRank = heap -> ranks[vertexId];
+        }
+        heap -> lastRank = minRank;
+        int vertexId = heap -> buckets[bucket];
+        heap -> buckets[bucket] = 0;
+        while (vertexId != 0)
+        {
+            int nextVertexId = heap -> next[vertexId];
+            INSTRUMENT_COUNT(siftSteps);
+            PushToBucket(heap, state, vertexId);
+            vertexId = nextVertexId;
+        }
+    }
+    const int minVertexId = heap -> buckets[0];
+    RemoveFromBucket(heap, state, minVertexId);
+    heap -> numberOfElements --;
+    state -> heapIndices[minVertexId - 1] = SETTLED;
+    return minVertexId;
+}
+
+static int RadixHeapDecreaseKey(void* queue, struct SearchState* state, const int vertexId, const double key)
+{
+    struct RadixHeap* heap = (struct RadixHeap*) queue;
+    if (state -> heapIndices[vertexId - 1] < 0)
+        return -1;
+    const uint64_t rank = KeyToRank(key);
+    if (rank >= heap -> ranks[vertexId])
+        return -2;
+    CheckMonotone(heap, rank, vertexId);
+    RemoveFromBucket(heap, state, vertexId);
+    heap -> ranks[vertexId] = rank;
+    PushToBucket(heap, state, vertexId);
+    return 0;
+}
+
+static void RadixHeapPrint(const void* queue)
+{
+    const struct RadixHeap* heap = (const struct RadixHeap*) queue;
+    printf("\nQueue - Number of Vertices: %d\n", heap -> numberOfElements);
+    for (int bucket = 0 ; bucket < NUMBER_OF_BUCKETS ; bucket++)
+    {
+        if (heap -> buckets[bucket] == 0)
+            continue;
+        printf("Bucket %d:", bucket);
+        for (int vertexId = heap -> buckets[bucket] ; vertexId != 0 ; vertexId = heap -> next[vertexId])
+            printf(" %d", vertexId);
+        printf("\n");
+    }
+}
+
+static void RadixHeapDestroy(void* queue)
+{
+    struct RadixHeap* heap = (struct RadixHeap*) queue;
+    free(heap -> ranks);
+    free(heap -> next);
+    free(heap -> prev);
+    free(heap);
+}
+
+const struct QueueOperations RadixHeapOperations = {
+    "radix",
+    RadixHeapCreate,
+    RadixHeapClear,
+    RadixHeapSize,
+    RadixHeapInsert,
+    RadixHeapExtractMin,
+    RadixHeapDecreaseKey,
+    RadixHeapPrint,
+    RadixHeapDestroy
+};
\ No newline at end of file
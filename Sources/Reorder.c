@@ -0,0 +1,264 @@
+#include "Reorder.h"
+#include "Arena.h"
+#include <stdlib.h>
+#include <string.h>
+
+struct RankedVertex {
+    int degree;
+    int vertexId;
+};
+
+// Private Methods:
+static int CompareByDegree(const void* first, const void* second)
+{
+    const struct RankedVertex* firstVertex = (const struct RankedVertex*) first;
+    const struct RankedVertex* secondVertex = (const struct RankedVertex*) second;
+    if (firstVertex -> degree != secondVertex -> degree)
+        return firstVertex -> degree < secondVertex -> degree ? -1 : 1;
+    return firstVertex -> vertexId < secondVertex -> vertexId ? -1 : 1;
+}
+
+static int CompareByDegreeDescending(const void* first, const void* second)
+{
+    const struct RankedVertex* firstVertex = (const struct RankedVertex*) first;
+    const struct RankedVertex* secondVertex = (const struct RankedVertex*) second;
+    if (firstVertex -> degree != secondVertex -> degree)
+        return firstVertex -> degree > secondVertex -> degree ? -1 : 1;
+    return firstVertex -> vertexId < secondVertex -> vertexId ? -1 : 1;
+}
+
+/**
+ * @brief Append the unvisited out-neighbours of a vertex in graph to the order, marking them
+ * ! Complexity: O(deg)
+ */
+static void AppendNeighbours(const struct Graph* graph, const int vertexId, int* order, int* size, bool* isVisited)
+{
+    for (int edge = graph -> edgeOffsets[vertexId - 1] ; edge < graph -> edgeOffsets[vertexId] ; edge++)
+    {
+        const int neighbourId = graph -> edgeTargets[edge];
+        if (isVisited[neighbourId - 1])
+            continue;
+        isVisited[neighbourId - 1] = true;
+        order[(*size) ++] = neighbourId;
+    }
+}
+
+// Public Methods:
+/**
+ * @brief Parse a vertex order name: none, bfs, rcm or degree
+ * ! Complexity: O(1)
+ * @param name 
+ * @param order 
+ * @return true if the name is known
+ */
+bool ParseVertexOrder(const char* name, enum VertexOrder* order)
+{
+    if (strcmp(name, "none") == 0)
+        *order = ORDER_NONE;
+    else if (strcmp(name, "bfs") == 0)
+        *order = ORDER_BFS;
+    else if (strcmp(name, "rcm") == 0)
+        *order = ORDER_RCM;
+    else if (strcmp(name, "degree") == 0)
+        *order = ORDER_DEGREE;
+    else
+        return false;
+    return true;
+}
+
+/**
+ * @brief Compute a relabeling of the vertices of a Graph in the given order. Edges count
+ * in both directions and the degree of a vertex is its in-degree plus its out-degree.
+ * The BFS orders visit every component, one after the other.
+ * ! Complexity: O(V + E) for bfs, O(VlgV + E lg deg) for rcm and degree
+ * @param graph 
+ * @param order 
+ * @return struct Relabeling* 
+ */
+struct Relabeling* CreateRelabeling(const struct Graph* graph, const enum VertexOrder order)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    struct Relabeling* relabeling = (struct Relabeling*) malloc(sizeof(struct Relabeling));
+    relabeling -> numberOfVertices = numberOfVertices;
+    relabeling -> newIds = (int*) malloc(numberOfVertices * sizeof(int));
+    relabeling -> oldIds = (int*) malloc(numberOfVertices * sizeof(int));
+    int* oldIds = relabeling -> oldIds;
+    if (order == ORDER_NONE)
+    {
+        for (int index = 0 ; index < numberOfVertices ; index++)
+            oldIds[index] = index + 1;
+    }
+    else
+    {
+        struct Graph* reverseGraph = CreateReverseGraph(graph); // ! O(V + E)
+        const size_t rankedBytes = numberOfVertices * sizeof(struct RankedVertex);
+        struct Arena* scratch = CreateArena(2 * ARENA_BYTES(rankedBytes) + ARENA_BYTES(numberOfVertices * sizeof(int)) + ARENA_BYTES(numberOfVertices * sizeof(bool)));
+        struct RankedVertex* ranked = (struct RankedVertex*) ArenaAllocate(scratch, rankedBytes);
+        int* degrees = (int*) ArenaAllocate(scratch, numberOfVertices * sizeof(int));
+        for (int index = 0 ; index < numberOfVertices ; index++)
+        {
+            degrees[index] = graph -> edgeOffsets[index + 1] - graph -> edgeOffsets[index] + reverseGraph -> edgeOffsets[index + 1] - reverseGraph -> edgeOffsets[index];
+            ranked[index].degree = degrees[index];
+            ranked[index].vertexId = index + 1;
+        }
+        if (order == ORDER_DEGREE)
+        {
+            qsort(ranked, numberOfVertices, sizeof(struct RankedVertex), CompareByDegreeDescending);
+            for (int index = 0 ; index < numberOfVertices ; index++)
+                oldIds[index] = ranked[index].vertexId;
+        }
+        else
+        {
+            // oldIds doubles as the BFS queue: the order is the sequence of dequeued vertices.
+            // Cuthill-McKee starts every component at its lowest-degree vertex and queues the
+            // neighbours of a vertex by increasing degree
+            const bool isCuthillMcKee = order == ORDER_RCM;
+            if (isCuthillMcKee)
+                qsort(ranked, numberOfVertices, sizeof(struct RankedVertex), CompareByDegree);
+            struct RankedVertex* neighbours = (struct RankedVertex*) ArenaAllocate(scratch, rankedBytes);
+            bool* isVisited = (bool*) ArenaAllocateZeroed(scratch, numberOfVertices * sizeof(bool));
+            int size = 0;
+            for (int candidate = 0 ; candidate < numberOfVertices ; candidate++)
+            {
+                const int startId = isCuthillMcKee ? ranked[candidate].vertexId : candidate + 1;
+                if (isVisited[startId - 1])
+                    continue;
+                isVisited[startId - 1] = true;
+                oldIds[size ++] = startId;
+                for (int head = size - 1 ; head < size ; head++)
+                {
+                    const int first = size;
+                    AppendNeighbours(graph, oldIds[head], oldIds, &size, isVisited);
+                    AppendNeighbours(reverseGraph, oldIds[head], oldIds, &size, isVisited);
+                    if (!isCuthillMcKee || size - first < 2)
+                        continue;
+                    for (int position = first ; position < size ; position++)
+                    {
+                        neighbours[position - first].degree = degrees[oldIds[position] - 1];
+                        neighbours[position - first].vertexId = oldIds[position];
+                    }
+                    qsort(neighbours, size - first, sizeof(struct RankedVertex), CompareByDegree);
+                    for (int position = first ; position < size ; position++)
+                        oldIds[position] = neighbours[position - first].vertexId;
+                }
+            }
+            if (isCuthillMcKee)
+            {
+                for (int low = 0, high = numberOfVertices - 1 ; low < high ; low++, high--)
+                {
+                    const int vertexId = oldIds[low];
+                    oldIds[low] = oldIds[high];
+                    oldIds[high] = vertexId;
+                }
+            }
+        }
+        DestroyArena(scratch);
+        DestroyGraph(reverseGraph);
+    }
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        relabeling -> newIds[oldIds[index] - 1] = index + 1;
+    return relabeling;
+}
+
+/**
+ * @brief Create the Graph with the vertices relabeled: new vertex p gets the edges of old
+ * vertex oldIds[p - 1], in the same order, with their targets relabeled
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @param relabeling 
+ * @return struct Graph* 
+ */
+struct Graph* RelabelGraph(const struct Graph* graph, const struct Relabeling* relabeling)
+{
+    const int numberOfVertices = graph -> numberOfVertices;
+    struct Graph* relabeledGraph = (struct Graph*) malloc(sizeof(struct Graph));
+    relabeledGraph -> numberOfVertices = numberOfVertices;
+    relabeledGraph -> numberOfEdges = graph -> numberOfEdges;
+    relabeledGraph -> mapping = NULL;
+    relabeledGraph -> mappingBytes = 0;
+    AllocateGraphArrays(relabeledGraph);
+    int position = 0;
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        relabeledGraph -> edgeOffsets[index] = position;
+        const int oldIndex = relabeling -> oldIds[index] - 1;
+        for (int edge = graph -> edgeOffsets[oldIndex] ; edge < graph -> edgeOffsets[oldIndex + 1] ; edge++, position++)
+        {
+            relabeledGraph -> edgeTargets[position] = relabeling -> newIds[graph -> edgeTargets[edge] - 1];
+            relabeledGraph -> edgeWeights[position] = graph -> edgeWeights[edge];
+        }
+    }
+    relabeledGraph -> edgeOffsets[numberOfVertices] = position;
+    return relabeledGraph;
+}
+
+/**
+ * @brief Turn the state of a search on a relabeled graph into the state of the same search
+ * on the original graph: entries move back to the original ids and so do the source and
+ * the previous vertices. The touched list is given up, so the next reset is a full one.
+ * ! Complexity: O(V)
+ * @param state 
+ * @param relabeling 
+ */
+void RestoreSearchState(struct SearchState* state, const struct Relabeling* relabeling)
+{
+    const int numberOfVertices = state -> numberOfVertices;
+    const size_t weightBytes = numberOfVertices * sizeof(double);
+    const size_t idBytes = numberOfVertices * sizeof(int);
+    struct Arena* scratch = CreateArena(ARENA_BYTES(weightBytes) + 2 * ARENA_BYTES(idBytes));
+    double* weights = (double*) ArenaAllocate(scratch, weightBytes);
+    int* heapIndices = (int*) ArenaAllocate(scratch, idBytes);
+    int* previousVertexIds = (int*) ArenaAllocate(scratch, idBytes);
+    memcpy(weights, state -> weights, weightBytes);
+    memcpy(heapIndices, state -> heapIndices, idBytes);
+    memcpy(previousVertexIds, state -> previousVertexIds, idBytes);
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        const int newIndex = relabeling -> newIds[index] - 1;
+        const int previousVertexId = previousVertexIds[newIndex];
+        state -> weights[index] = weights[newIndex];
+        state -> heapIndices[index] = heapIndices[newIndex];
+        state -> previousVertexIds[index] = previousVertexId > 0 ? relabeling -> oldIds[previousVertexId - 1] : previousVertexId;
+    }
+    if (state -> sourceId > 0)
+        state -> sourceId = relabeling -> oldIds[state -> sourceId - 1];
+    state -> numberOfTouched = -1;
+    DestroyArena(scratch);
+}
+
+/**
+ * @brief Average distance between the ids of the two ends of an edge, a measure of how far
+ * apart in memory the search touches the entries of both
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @param bandwidth (output) the largest such distance
+ * @return double 
+ */
+double GetAverageEdgeGap(const struct Graph* graph, int* bandwidth)
+{
+    double totalGap = 0.0;
+    *bandwidth = 0;
+    for (int index = 0 ; index < graph -> numberOfVertices ; index++)
+    {
+        for (int edge = graph -> edgeOffsets[index] ; edge < graph -> edgeOffsets[index + 1] ; edge++)
+        {
+            const int gap = abs(graph -> edgeTargets[edge] - (index + 1));
+            totalGap += gap;
+            if (gap > *bandwidth)
+                *bandwidth = gap;
+        }
+    }
+    return graph -> numberOfEdges > 0 ? totalGap / graph -> numberOfEdges : 0.0;
+}
+
+/**
+ * @brief Deallocate and Destroy a Relabeling Object
+ * ! Complexity: O(1)
+ * @param relabeling 
+ */
+void DestroyRelabeling(struct Relabeling* relabeling)
+{
+    free(relabeling -> newIds);
+    free(relabeling -> oldIds);
+    free(relabeling);
+}
\ No newline at end of file
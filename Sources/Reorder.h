@@ -0,0 +1,39 @@
+#ifndef __REORDER_H__
+#define __REORDER_H__
+#include "Graph.h"
+#include "Search.h"
+#include <stdbool.h>
+
+// Vertex orders a graph can be relabeled in, all computed on its undirected view
+enum VertexOrder {
+    ORDER_NONE,     // the ids of the input file
+    ORDER_BFS,      // breadth-first from vertex 1, then from the lowest unvisited id
+    ORDER_RCM,      // reverse Cuthill-McKee: BFS from low-degree vertices, neighbours by degree, reversed
+    ORDER_DEGREE    // hubs first, by decreasing degree
+};
+
+/**
+ * A permutation of the vertex ids, both ways: vertex v of the original
+ * graph is vertex newIds[v - 1] of the relabeled one, and vertex p of the
+ * relabeled graph is vertex oldIds[p - 1] of the original.
+ */
+struct Relabeling {
+    int numberOfVertices;
+    int* newIds;
+    int* oldIds;
+};
+
+// Public Methods:
+bool ParseVertexOrder(const char* name, enum VertexOrder* order);
+
+struct Relabeling* CreateRelabeling(const struct Graph* graph, const enum VertexOrder order);
+
+struct Graph* RelabelGraph(const struct Graph* graph, const struct Relabeling* relabeling);
+
+void RestoreSearchState(struct SearchState* state, const struct Relabeling* relabeling);
+
+double GetAverageEdgeGap(const struct Graph* graph, int* bandwidth);
+
+void DestroyRelabeling(struct Relabeling* relabeling);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include "Search.h"
+#include "Arena.h"
+#include <string.h>
+
+// Private Methods:
+/**
+ * @brief Restore the initial (unreached) state of a vertex
+ * ! Complexity: O(1)
+ * @param state 
+ * @param index 
+ */
+static void ResetVertex(struct SearchState* state, const int index)
+{
+    state -> weights[index] = state -> unreachableWeight;
+    state -> heapIndices[index] = UNDISCOVERED;
+    state -> previousVertexIds[index] = -1;
+}
+
+// Public Methods:
+/**
+ * @brief Create a SearchState object (call ResetSearchState before use)
+ * ! Complexity: O(1)
+ * @param numberOfVertices 
+ * @param sourceWeight 
+ * @param unreachableWeight 
+ * @return struct SearchState* 
+ */
+struct SearchState* CreateSearchState(const int numberOfVertices, const double sourceWeight, const double unreachableWeight)
+{
+    struct SearchState* state = (struct SearchState*) malloc(sizeof(struct SearchState));
+    state -> numberOfVertices = numberOfVertices;
+    state -> sourceId = -1;
+    state -> sourceWeight = sourceWeight;
+    state -> unreachableWeight = unreachableWeight;
+    const size_t weightBytes = numberOfVertices * sizeof(double);
+    const size_t idBytes = numberOfVertices * sizeof(int);
+    state -> arena = CreateArena(ARENA_BYTES(weightBytes) + 3 * ARENA_BYTES(idBytes));
+    state -> weights = (double*) ArenaAllocate(state -> arena, weightBytes);
+    state -> heapIndices = (int*) ArenaAllocate(state -> arena, idBytes);
+    state -> previousVertexIds = (int*) ArenaAllocate(state -> arena, idBytes);
+    state -> numberOfTouched = -1;
+    state -> touchedVertexIds = (int*) ArenaAllocate(state -> arena, idBytes);
+    return state;
+}
+
+/**
+ * @brief Prepare a SearchState object for a new query from the given source.
+ * Only the vertices touched by the previous query are reset, so a search that
+ * explored a small part of the graph is cheap to undo.
+ * ! Complexity: O(V) on first use, O(touched vertices) afterwards
+ * @param state 
+ * @param sourceId 
+ */
+void ResetSearchState(struct SearchState* state, const int sourceId)
+{
+    if (state -> numberOfTouched < 0)
+    {
+        for (int index = 0 ; index < state -> numberOfVertices ; index++)
+            ResetVertex(state, index);
+    }
+    else
+    {
+        for (int touched = 0 ; touched < state -> numberOfTouched ; touched++)
+            ResetVertex(state, state -> touchedVertexIds[touched] - 1);
+        ResetVertex(state, state -> sourceId - 1);
+    }
+    state -> numberOfTouched = 0;
+    state -> sourceId = sourceId;
+    state -> weights[sourceId - 1] = state -> sourceWeight;
+}
+
+/**
+ * @brief Record that a vertex's state is about to change in the current query.
+ * Every vertex enters the queue at most once per query, so PQInsert calls this.
+ * ! Complexity: O(1)
+ * @param state 
+ * @param vertexId 
+ */
+void MarkVertexTouched(struct SearchState* state, const int vertexId)
+{
+    if (state -> numberOfTouched >= 0)
+        state -> touchedVertexIds[state -> numberOfTouched ++] = vertexId;
+}
+
+/**
+ * @brief Parse a path format name: paths, parents, tree or none
+ * ! Complexity: O(1)
+ * @param name 
+ * @param format 
+ * @return bool false if the name is unknown
+ */
+bool ParsePathFormat(const char* name, enum PathFormat* format)
+{
+    if (strcmp(name, "paths") == 0)
+        *format = PATHS_LISTED;
+    else if (strcmp(name, "parents") == 0)
+        *format = PATHS_PARENTS;
+    else if (strcmp(name, "tree") == 0)
+        *format = PATHS_TREE;
+    else if (strcmp(name, "none") == 0)
+        *format = PATHS_NONE;
+    else
+        return false;
+    return true;
+}
+
+/**
+ * @brief Write the path of the search tree that ends at targetId into path (room for V
+ * vertices): from the root of its branch, which is the source if targetId was reached,
+ * to targetId itself. No memory is allocated.
+ * ! Complexity: O(path length)
+ * @param state 
+ * @param targetId 
+ * @param path 
+ * @return int number of vertices on the path (1 if targetId has no previous vertex)
+ */
+int GetPath(const struct SearchState* state, const int targetId, int* path)
+{
+    int length = 0;
+    for (int vertexId = targetId ; vertexId != -1 ; vertexId = state -> previousVertexIds[vertexId - 1])
+        length ++;
+    int position = length;
+    for (int vertexId = targetId ; vertexId != -1 ; vertexId = state -> previousVertexIds[vertexId - 1])
+        path[-- position] = vertexId;
+    return length;
+}
+
+/**
+ * @brief Write the shortest-path tree as a parent array: line v holds the previous vertex
+ * of v, or -1 for the source and for unreachable or unsettled vertices
+ * ! Complexity: O(V)
+ * @param state 
+ * @param file 
+ */
+void WriteParentArray(const struct SearchState* state, FILE* file)
+{
+    for (int index = 0 ; index < state -> numberOfVertices ; index++)
+    {
+        const bool isReached = state -> heapIndices[index] == SETTLED && state -> weights[index] != state -> unreachableWeight;
+        fprintf(file, "%d\n", isReached ? state -> previousVertexIds[index] : -1);
+    }
+}
+
+/**
+ * @brief Write the shortest-path tree in depth-first preorder from the source, one
+ * "depth vertex" line per reached vertex. Paths share their prefixes: the path to a
+ * vertex is the last vertex listed at each smaller depth, then the vertex itself, so
+ * all paths together take O(V) output instead of O(V * depth).
+ * ! Complexity: O(V)
+ * @param state 
+ * @param file 
+ */
+void WritePathTree(const struct SearchState* state, FILE* file)
+{
+    const int numberOfVertices = state -> numberOfVertices;
+    // Children of every vertex in increasing id order, a counting sort by parent: once it
+    // is done, the children of v are childIds[childOffsets[v] .. childOffsets[v + 1] - 1]
+    const size_t idBytes = (numberOfVertices > 0 ? numberOfVertices : 1) * sizeof(int);
+    struct Arena* scratch = CreateArena(ARENA_BYTES((numberOfVertices + 2) * sizeof(int)) + 3 * ARENA_BYTES(idBytes));
+    int* childOffsets = (int*) ArenaAllocateZeroed(scratch, (numberOfVertices + 2) * sizeof(int));
+    for (int index = 0 ; index < numberOfVertices ; index++)
+    {
+        if (state -> heapIndices[index] == SETTLED && state -> previousVertexIds[index] != -1)
+            childOffsets[state -> previousVertexIds[index]] ++;
+    }
+    for (int index = 0 ; index < numberOfVertices ; index++)
+        childOffsets[index + 1] += childOffsets[index];
+    childOffsets[numberOfVertices + 1] = childOffsets[numberOfVertices];
+    int* childIds = (int*) ArenaAllocate(scratch, idBytes);
+    for (int index = numberOfVertices - 1 ; index >= 0 ; index--)
+    {
+        if (state -> heapIndices[index] == SETTLED && state -> previousVertexIds[index] != -1)
+            childIds[-- childOffsets[state -> previousVertexIds[index]]] = index + 1;
+    }
+
+    // Every vertex is pushed once, children in reverse so they come off in increasing order
+    int* stackIds = (int*) ArenaAllocate(scratch, idBytes);
+    int* stackDepths = (int*) ArenaAllocate(scratch, idBytes);
+    int stackSize = 0;
+    stackIds[stackSize] = state -> sourceId;
+    stackDepths[stackSize ++] = 0;
+    while (stackSize > 0)
+    {
+        stackSize --;
+        const int vertexId = stackIds[stackSize];
+        const int depth = stackDepths[stackSize];
+        fprintf(file, "%d %d\n", depth, vertexId);
+        for (int child = childOffsets[vertexId + 1] - 1 ; child >= childOffsets[vertexId] ; child--)
+        {
+            stackIds[stackSize] = childIds[child];
+            stackDepths[stackSize ++] = depth + 1;
+        }
+    }
+    DestroyArena(scratch);
+}
+
+/**
+ * @brief Deallocate and destroy a SearchState object
+ * ! Complexity: O(1)
+ * @param state 
+ */
+void DestroySearchState(struct SearchState* state)
+{
+    DestroyArena(state -> arena);
+    free(state);
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef __SEARCH_H__
+#define __SEARCH_H__
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+
+struct Arena;
+
+/**
+ * Per-query mutable state of a search, kept apart from the read-only graph
+ * so that one loaded graph can answer many queries. Indexed by vertexId - 1.
+ * Its arrays share one arena and are released together.
+ */
+struct SearchState {
+    int numberOfVertices;
+    int sourceId;
+    // Weight of the source and of vertices not reached yet, as defined by the metric
+    double sourceWeight;
+    double unreachableWeight;
+    double* weights;
+    int* heapIndices;
+    int* previousVertexIds;
+    // Vertices whose state changed since the last reset (-1: all of them)
+    int numberOfTouched;
+    int* touchedVertexIds;
+    struct Arena* arena;
+};
+
+// Heap index of a vertex that has been extracted from the queue
+#define SETTLED (-1)
+// Heap index of a vertex that has not entered the queue yet
+#define UNDISCOVERED (-2)
+
+// How the paths of a finished search are printed
+enum PathFormat {
+    PATHS_LISTED,   // every path in full, O(V * depth)
+    PATHS_PARENTS,  // the parent array, O(V)
+    PATHS_TREE,     // the tree in depth-first order, O(V)
+    PATHS_NONE
+};
+
+// Public Methods:
+struct SearchState* CreateSearchState(const int numberOfVertices, const double sourceWeight, const double unreachableWeight);
+
+void ResetSearchState(struct SearchState* state, const int sourceId);
+
+void MarkVertexTouched(struct SearchState* state, const int vertexId);
+
+bool ParsePathFormat(const char* name, enum PathFormat* format);
+
+int GetPath(const struct SearchState* state, const int targetId, int* path);
+
+void WriteParentArray(const struct SearchState* state, FILE* file);
+
+void WritePathTree(const struct SearchState* state, FILE* file);
+
+void DestroySearchState(struct SearchState* state);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,134 @@
+#ifndef __SEMIRING_H__
+#define __SEMIRING_H__
+#include <stdbool.h>
+#include <limits.h>
+#include <math.h>
+
+/**
+ * Path semirings the search engine is instantiated over (see DijkstraTemplate.h).
+ * Each semiring <S> provides:
+ *   <S>Combine(pathWeight, edgeWeight)   weight of a path extended by one edge
+ *   <S>Join(pathWeight, otherWeight)     weight of two paths put end to end
+ *   <S>Residual(weight, prefixWeight)    inverse of Join: what a prefix leaves of weight
+ *                                        (only where Join is invertible, not for Widest)
+ *   <S>IsBetter(weight, otherWeight)     strict preference between two weights
+ *   <S>QueueKey(weight)                  min-queue key, ordered like IsBetter
+ *   <S>_IDENTITY (upper-case prefix)     weight of the empty path (the source)
+ *   <S>_UNREACHABLE (upper-case prefix)  weight of a vertex with no path yet
+ * All of them are static inline so every instantiation compiles down to the
+ * plain operators; there is no runtime branch per relaxation.
+ */
+
+// Additive cost (shortest paths, binary A)
+#define ADDITIVE_IDENTITY 0.0
+#define ADDITIVE_UNREACHABLE ((double) INT_MAX)
+
+static inline double AdditiveCombine(const double pathWeight, const double edgeWeight)
+{
+    return pathWeight + edgeWeight;
+}
+
+static inline double AdditiveJoin(const double pathWeight, const double otherWeight)
+{
+    return pathWeight + otherWeight;
+}
+
+static inline double AdditiveResidual(const double weight, const double prefixWeight)
+{
+    return weight - prefixWeight;
+}
+
+static inline bool AdditiveIsBetter(const double weight, const double otherWeight)
+{
+    return weight < otherWeight;
+}
+
+static inline double AdditiveQueueKey(const double weight)
+{
+    return weight;
+}
+
+// Multiplicative reliability (most reliable paths, binary B)
+#define RELIABILITY_IDENTITY 1.0
+#define RELIABILITY_UNREACHABLE 0.0
+
+static inline double ReliabilityCombine(const double pathWeight, const double edgeWeight)
+{
+    return pathWeight * edgeWeight;
+}
+
+static inline double ReliabilityJoin(const double pathWeight, const double otherWeight)
+{
+    return pathWeight * otherWeight;
+}
+
+static inline double ReliabilityResidual(const double weight, const double prefixWeight)
+{
+    return weight / prefixWeight;
+}
+
+static inline bool ReliabilityIsBetter(const double weight, const double otherWeight)
+{
+    return weight > otherWeight;
+}
+
+static inline double ReliabilityQueueKey(const double weight)
+{
+    return -weight;
+}
+
+// Widest path (maximum bottleneck): a path is as wide as its narrowest edge
+#define WIDEST_IDENTITY INFINITY
+#define WIDEST_UNREACHABLE (-INFINITY)
+
+static inline double WidestCombine(const double pathWeight, const double edgeWeight)
+{
+    return edgeWeight < pathWeight ? edgeWeight : pathWeight;
+}
+
+static inline double WidestJoin(const double pathWeight, const double otherWeight)
+{
+    return otherWeight < pathWeight ? otherWeight : pathWeight;
+}
+
+static inline bool WidestIsBetter(const double weight, const double otherWeight)
+{
+    return weight > otherWeight;
+}
+
+static inline double WidestQueueKey(const double weight)
+{
+    return -weight;
+}
+
+// Fewest hops: edge weights are ignored and every edge counts as one
+#define HOPS_IDENTITY 0.0
+#define HOPS_UNREACHABLE ((double) INT_MAX)
+
+static inline double HopsCombine(const double pathWeight, const double edgeWeight)
+{
+    (void) edgeWeight;
+    return pathWeight + 1.0;
+}
+
+static inline double HopsJoin(const double pathWeight, const double otherWeight)
+{
+    return pathWeight + otherWeight;
+}
+
+static inline double HopsResidual(const double weight, const double prefixWeight)
+{
+    return weight - prefixWeight;
+}
+
+static inline bool HopsIsBetter(const double weight, const double otherWeight)
+{
+    return weight < otherWeight;
+}
+
+static inline double HopsQueueKey(const double weight)
+{
+    return weight;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include "Snapshot.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Private Methods:
+static inline uint64_t AlignUp(const uint64_t position)
+{
+    return (position + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT * SNAPSHOT_ALIGNMENT;
+}
+
+static void SnapshotError(const char* fileName, const char* message)
+{
+    fprintf(stderr, "Snapshot %s: %s\n", fileName, message);
+    exit(-1);
+}
+
+// Public Methods:
+/**
+ * @brief Word-at-a-time multiplicative hash of a buffer; a trailing partial
+ * word is zero-padded
+ * ! Complexity: O(bytes)
+ * @param bytes 
+ * @param numberOfBytes 
+ * @return uint64_t 
+ */
+uint64_t ComputeChecksum(const unsigned char* bytes, const uint64_t numberOfBytes)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (uint64_t position = 0 ; position < numberOfBytes ; position += 8)
+    {
+        uint64_t word = 0;
+        memcpy(&word, bytes + position, numberOfBytes - position < sizeof(word) ? numberOfBytes - position : sizeof(word));
+        hash = (hash ^ word) * 0x100000001b3ull;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+/**
+ * @brief Hash of the CSR arrays, so a sidecar file computed for one graph is never
+ * used with another
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @return uint64_t 
+ */
+uint64_t ComputeGraphFingerprint(const struct Graph* graph)
+{
+    uint64_t fingerprint = ComputeChecksum((const unsigned char*) graph -> edgeOffsets, (graph -> numberOfVertices + 1) * sizeof(int));
+    fingerprint = fingerprint * 0x9e3779b97f4a7c15ull ^ ComputeChecksum((const unsigned char*) graph -> edgeTargets, graph -> numberOfEdges * sizeof(int));
+    fingerprint = fingerprint * 0x9e3779b97f4a7c15ull ^ ComputeChecksum((const unsigned char*) graph -> edgeWeights, graph -> numberOfEdges * sizeof(double));
+    return fingerprint;
+}
+
+/**
+ * @brief Check whether a file starts with the snapshot magic
+ * ! Complexity: O(1)
+ * @param fileName 
+ * @return bool 
+ */
+bool IsGraphSnapshot(const char* fileName)
+{
+    char magic[8] = { 0 };
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL)
+        return false;
+    size_t numberOfRead = fread(magic, 1, sizeof(magic), file);
+    fclose(file);
+    return numberOfRead == sizeof(magic) && memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0;
+}
+
+/**
+ * @brief Write a Graph to a binary snapshot file (via a temporary file and a rename)
+ * ! Complexity: O(V + E)
+ * @param graph 
+ * @param fileName 
+ */
+void WriteGraphSnapshot(const struct Graph* graph, const char* fileName)
+{
+    struct SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    header.numberOfVertices = graph -> numberOfVertices;
+    header.numberOfEdges = graph -> numberOfEdges;
+    header.offsetsPosition = AlignUp(sizeof(header));
+    header.targetsPosition = AlignUp(header.offsetsPosition + (header.numberOfVertices + 1) * sizeof(int));
+    header.weightsPosition = AlignUp(header.targetsPosition + header.numberOfEdges * sizeof(int));
+    header.fileBytes = AlignUp(header.weightsPosition + header.numberOfEdges * sizeof(double));
+
+    // Lay the payload out in memory first so the checksum and the write see the same bytes
+    const uint64_t payloadBytes = header.fileBytes - header.offsetsPosition;
+    unsigned char* payload = (unsigned char*) calloc(payloadBytes, 1);
+    memcpy(payload, graph -> edgeOffsets, (header.numberOfVertices + 1) * sizeof(int));
+    memcpy(payload + (header.targetsPosition - header.offsetsPosition), graph -> edgeTargets, header.numberOfEdges * sizeof(int));
+    memcpy(payload + (header.weightsPosition - header.offsetsPosition), graph -> edgeWeights, header.numberOfEdges * sizeof(double));
+    header.checksum = ComputeChecksum(payload, payloadBytes);
+
+    char* temporaryName = (char*) malloc(strlen(fileName) + 5);
+    sprintf(temporaryName, "%s.tmp", fileName);
+    FILE* file = fopen(temporaryName, "wb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open file %s\n", temporaryName);
+        exit(-1);
+    }
+    unsigned char padding[SNAPSHOT_ALIGNMENT] = { 0 };
+    bool isWritten = fwrite(&header, sizeof(header), 1, file) == 1
+        && fwrite(padding, header.offsetsPosition - sizeof(header), 1, file) == 1
+        && fwrite(payload, payloadBytes, 1, file) == 1;
+    if (fclose(file) != 0 || !isWritten || rename(temporaryName, fileName) != 0)
+    {
+        fprintf(stderr, "Cannot write snapshot %s\n", fileName);
+        exit(-1);
+    }
+    free(temporaryName);
+    free(payload);
+}
+
+/**
+ * @brief Map a snapshot file and use its arrays in place: nothing is parsed or copied.
+ * The header is always validated; the checksum only if isVerifying (it reads every page).
+ * ! Complexity: O(1), O(V + E) if verifying
+ * @param fileName 
+ * @param isVerifying 
+ * @return struct Graph* 
+ */
+struct Graph* LoadGraphSnapshot(const char* fileName, const bool isVerifying)
+{
+    int descriptor = open(fileName, O_RDONLY);
+    if (descriptor == -1)
+    {
+        fprintf(stderr, "Cannot open file %s\n", fileName);
+        exit(-1);
+    }
+    struct stat fileStatus;
+    if (fstat(descriptor, &fileStatus) == -1)
+    {
+        fprintf(stderr, "Cannot read file %s\n", fileName);
+        exit(-1);
+    }
+    const uint64_t numberOfBytes = fileStatus.st_size;
+    if (numberOfBytes < sizeof(struct SnapshotHeader))
+        SnapshotError(fileName, "File is too short");
+    unsigned char* bytes = (unsigned char*) mmap(NULL, numberOfBytes, PROT_READ, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if (bytes == MAP_FAILED)
+        SnapshotError(fileName, "Cannot map file");
+
+    const struct SnapshotHeader* header = (const struct SnapshotHeader*) bytes;
+    if (memcmp(header -> magic, SNAPSHOT_MAGIC, sizeof(header -> magic)) != 0)
+        SnapshotError(fileName, "Not a graph snapshot");
+    if (header -> version != SNAPSHOT_VERSION)
+        SnapshotError(fileName, "Unsupported snapshot version");
+    if (header -> byteOrder != SNAPSHOT_BYTE_ORDER)
+        SnapshotError(fileName, "Snapshot was written on a machine with another byte order");
+    if (header -> fileBytes != numberOfBytes || header -> numberOfVertices < 1 || header -> numberOfVertices >= INT_MAX || header -> numberOfEdges >= INT_MAX
+        || header -> offsetsPosition != AlignUp(sizeof(struct SnapshotHeader))
+        || header -> targetsPosition != AlignUp(header -> offsetsPosition + (header -> numberOfVertices + 1) * sizeof(int))
+        || header -> weightsPosition != AlignUp(header -> targetsPosition + header -> numberOfEdges * sizeof(int))
+        || header -> fileBytes != AlignUp(header -> weightsPosition + header -> numberOfEdges * sizeof(double)))
+        SnapshotError(fileName, "Corrupt header");
+    if (isVerifying && ComputeChecksum(bytes + header -> offsetsPosition, numberOfBytes - header -> offsetsPosition) != header -> checksum)
+        SnapshotError(fileName, "Checksum mismatch");
+
+    struct Graph* graph = (struct Graph*) malloc(sizeof(struct Graph));
+    graph -> numberOfVertices = (int) header -> numberOfVertices;
+    graph -> numberOfEdges = (int) header -> numberOfEdges;
+    graph -> edgeOffsets = (int*) (bytes + header -> offsetsPosition);
+    graph -> edgeTargets = (int*) (bytes + header -> targetsPosition);
+    graph -> edgeWeights = (double*) (bytes + header -> weightsPosition);
+    graph -> arena = NULL;
+    graph -> mapping = bytes;
+    graph -> mappingBytes = numberOfBytes;
+    return graph;
+}
\ No newline at end of file
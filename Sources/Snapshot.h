@@ -0,0 +1,41 @@
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+#include "Graph.h"
+#include <stdint.h>
+
+#define SNAPSHOT_MAGIC "DIJKCSR"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_ALIGNMENT 64
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+
+/**
+ * On-disk layout of a graph snapshot: this header, then the edgeOffsets,
+ * edgeTargets (int32) and edgeWeights (float64) arrays, each starting at a
+ * SNAPSHOT_ALIGNMENT-byte boundary so they can be used straight from a mapping.
+ * The checksum covers every byte after the header.
+ */
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t numberOfVertices;
+    uint64_t numberOfEdges;
+    uint64_t offsetsPosition;
+    uint64_t targetsPosition;
+    uint64_t weightsPosition;
+    uint64_t fileBytes;
+    uint64_t checksum;
+};
+
+// Public Methods:
+uint64_t ComputeChecksum(const unsigned char* bytes, const uint64_t numberOfBytes);
+
+uint64_t ComputeGraphFingerprint(const struct Graph* graph);
+
+bool IsGraphSnapshot(const char* fileName);
+
+void WriteGraphSnapshot(const struct Graph* graph, const char* fileName);
+
+struct Graph* LoadGraphSnapshot(const char* fileName, const bool isVerifying);
+
+#endif
\ No newline at end of file
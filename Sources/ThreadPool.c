@@ -0,0 +1,235 @@
+#include "ThreadPool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+struct WorkerArgument {
+    struct ThreadPool* pool;
+    int threadIndex;
+};
+
+/**
+ * Task indices [next, end) a thread still has to run. The owner takes from
+ * the front, thieves split off the back half; each range has its own lock
+ * and cache line.
+ */
+struct TaskRange {
+    pthread_mutex_t lock;
+    int next;
+    int end;
+} __attribute__((aligned(64)));
+
+struct StealingRun {
+    IndexedTask task;
+    void* context;
+    struct TaskRange* ranges;
+};
+
+// Private Methods:
+static void* WorkerMain(void* argument)
+{
+    struct ThreadPool* pool = ((struct WorkerArgument*) argument) -> pool;
+    const int threadIndex = ((struct WorkerArgument*) argument) -> threadIndex;
+    free(argument);
+    int seenGeneration = 0;
+    pthread_mutex_lock(&pool -> lock);
+    while (true)
+    {
+        while (!pool -> isStopping && pool -> generation == seenGeneration)
+            pthread_cond_wait(&pool -> taskReady, &pool -> lock);
+        if (pool -> isStopping)
+            break;
+        seenGeneration = pool -> generation;
+        ParallelTask task = pool -> task;
+        void* context = pool -> context;
+        pthread_mutex_unlock(&pool -> lock);
+
+        task(context, threadIndex, pool -> numberOfThreads);
+
+        pthread_mutex_lock(&pool -> lock);
+        if (-- pool -> numberOfRunning == 0)
+            pthread_cond_signal(&pool -> taskDone);
+    }
+    pthread_mutex_unlock(&pool -> lock);
+    return NULL;
+}
+
+static inline int TakeOwnTask(struct TaskRange* range)
+{
+    int taskIndex = -1;
+    pthread_mutex_lock(&range -> lock);
+    if (range -> next < range -> end)
+        taskIndex = range -> next ++;
+    pthread_mutex_unlock(&range -> lock);
+    return taskIndex;
+}
+
+/**
+ * @brief Move the back half of another thread's remaining tasks to this thread's range
+ * ! Complexity: O(threads)
+ * @return int the first stolen task, which the caller runs (-1 if every range is empty)
+ */
+static int StealTask(struct StealingRun* run, const int threadIndex, const int numberOfThreads)
+{
+    for (int offset = 1 ; offset < numberOfThreads ; offset++)
+    {
+        struct TaskRange* victim = &run -> ranges[(threadIndex + offset) % numberOfThreads];
+        pthread_mutex_lock(&victim -> lock);
+        const int remaining = victim -> end - victim -> next;
+        if (remaining <= 0)
+        {
+            pthread_mutex_unlock(&victim -> lock);
+            continue;
+        }
+        const int stolenEnd = victim -> end;
+        const int stolenStart = stolenEnd - (remaining + 1) / 2;
+        victim -> end = stolenStart;
+        pthread_mutex_unlock(&victim -> lock);
+
+        struct TaskRange* own = &run -> ranges[threadIndex];
+        pthread_mutex_lock(&own -> lock);
+        own -> next = stolenStart + 1;
+        own -> end = stolenEnd;
+        pthread_mutex_unlock(&own -> lock);
+        return stolenStart;
+    }
+    return -1;
+}
+
+static void StealingTask(void* context, const int threadIndex, const int numberOfThreads)
+{
+    struct StealingRun* run = (struct StealingRun*) context;
+    while (true)
+    {
+        int taskIndex = TakeOwnTask(&run -> ranges[threadIndex]);
+        if (taskIndex == -1)
+            taskIndex = StealTask(run, threadIndex, numberOfThreads);
+        if (taskIndex == -1)
+            return;
+        run -> task(run -> context, taskIndex, threadIndex);
+    }
+}
+
+// Public Methods:
+/**
+ * @brief Get the number of online processors
+ * ! Complexity: O(1)
+ * @return int 
+ */
+int GetDefaultNumberOfThreads()
+{
+    long numberOfProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+    return numberOfProcessors > 0 ? (int) numberOfProcessors : 1;
+}
+
+/**
+ * @brief Create a ThreadPool object with numberOfThreads - 1 worker threads
+ * ! Complexity: O(threads)
+ * @param numberOfThreads 
+ * @return struct ThreadPool* 
+ */
+struct ThreadPool* CreateThreadPool(const int numberOfThreads)
+{
+    struct ThreadPool* pool = (struct ThreadPool*) malloc(sizeof(struct ThreadPool));
+    pool -> numberOfThreads = numberOfThreads > 0 ? numberOfThreads : 1;
+    pool -> workers = (pthread_t*) malloc(pool -> numberOfThreads * sizeof(pthread_t));
+    pthread_mutex_init(&pool -> lock, NULL);
+    pthread_cond_init(&pool -> taskReady, NULL);
+    pthread_cond_init(&pool -> taskDone, NULL);
+    pool -> task = NULL;
+    pool -> context = NULL;
+    pool -> generation = 0;
+    pool -> numberOfRunning = 0;
+    pool -> isStopping = false;
+    for (int threadIndex = 1 ; threadIndex < pool -> numberOfThreads ; threadIndex++)
+    {
+        struct WorkerArgument* argument = (struct WorkerArgument*) malloc(sizeof(struct WorkerArgument));
+        argument -> pool = pool;
+        argument -> threadIndex = threadIndex;
+        if (pthread_create(&pool -> workers[threadIndex], NULL, WorkerMain, argument) != 0)
+        {
+            fprintf(stderr, "Cannot create worker thread %d\n", threadIndex);
+            exit(-1);
+        }
+    }
+    return pool;
+}
+
+/**
+ * @brief Run task(context, threadIndex, numberOfThreads) on every thread of the pool and wait for all of them
+ * ! Complexity: O(task)
+ * @param pool 
+ * @param task 
+ * @param context 
+ */
+void RunInParallel(struct ThreadPool* pool, ParallelTask task, void* context)
+{
+    if (pool -> numberOfThreads == 1)
+    {
+        task(context, 0, 1);
+        return;
+    }
+    pthread_mutex_lock(&pool -> lock);
+    pool -> task = task;
+    pool -> context = context;
+    pool -> numberOfRunning = pool -> numberOfThreads - 1;
+    pool -> generation++;
+    pthread_cond_broadcast(&pool -> taskReady);
+    pthread_mutex_unlock(&pool -> lock);
+
+    task(context, 0, pool -> numberOfThreads);
+
+    pthread_mutex_lock(&pool -> lock);
+    while (pool -> numberOfRunning > 0)
+        pthread_cond_wait(&pool -> taskDone, &pool -> lock);
+    pthread_mutex_unlock(&pool -> lock);
+}
+
+/**
+ * @brief Run task(context, taskIndex, threadIndex) for every taskIndex in [0, numberOfTasks)
+ * on the pool and wait for all of them. Every thread starts with a contiguous block of
+ * indices and runs it in order; a thread that runs out steals half of another's rest.
+ * ! Complexity: O(tasks)
+ * @param pool 
+ * @param numberOfTasks 
+ * @param task 
+ * @param context 
+ */
+void RunTasksWithStealing(struct ThreadPool* pool, const int numberOfTasks, IndexedTask task, void* context)
+{
+    const int numberOfThreads = pool -> numberOfThreads;
+    struct StealingRun run;
+    run.task = task;
+    run.context = context;
+    run.ranges = (struct TaskRange*) aligned_alloc(64, numberOfThreads * sizeof(struct TaskRange));
+    for (int threadIndex = 0 ; threadIndex < numberOfThreads ; threadIndex++)
+    {
+        pthread_mutex_init(&run.ranges[threadIndex].lock, NULL);
+        run.ranges[threadIndex].next = (int) ((long long) threadIndex * numberOfTasks / numberOfThreads);
+        run.ranges[threadIndex].end = (int) ((long long) (threadIndex + 1) * numberOfTasks / numberOfThreads);
+    }
+    RunInParallel(pool, StealingTask, &run);
+    for (int threadIndex = 0 ; threadIndex < numberOfThreads ; threadIndex++)
+        pthread_mutex_destroy(&run.ranges[threadIndex].lock);
+    free(run.ranges);
+}
+
+/**
+ * @brief Stop the workers, then deallocate and destroy a ThreadPool object
+ * ! Complexity: O(threads)
+ * @param pool 
+ */
+void DestroyThreadPool(struct ThreadPool* pool)
+{
+    pthread_mutex_lock(&pool -> lock);
+    pool -> isStopping = true;
+    pthread_cond_broadcast(&pool -> taskReady);
+    pthread_mutex_unlock(&pool -> lock);
+    for (int threadIndex = 1 ; threadIndex < pool -> numberOfThreads ; threadIndex++)
+        pthread_join(pool -> workers[threadIndex], NULL);
+    pthread_mutex_destroy(&pool -> lock);
+    pthread_cond_destroy(&pool -> taskReady);
+    pthread_cond_destroy(&pool -> taskDone);
+    free(pool -> workers);
+    free(pool);
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef __THREADPOOL_H__
+#define __THREADPOOL_H__
+#include <pthread.h>
+#include <stdbool.h>
+
+typedef void (*ParallelTask)(void* context, const int threadIndex, const int numberOfThreads);
+
+typedef void (*IndexedTask)(void* context, const int taskIndex, const int threadIndex);
+
+/**
+ * Fork-join pool: RunInParallel runs the same task on every thread (the
+ * calling thread is thread 0) and returns once all of them have finished.
+ * RunTasksWithStealing spreads independent indexed tasks over it with work stealing.
+ */
+struct ThreadPool {
+    int numberOfThreads;
+    pthread_t* workers;
+    pthread_mutex_t lock;
+    pthread_cond_t taskReady;
+    pthread_cond_t taskDone;
+    ParallelTask task;
+    void* context;
+    int generation;
+    int numberOfRunning;
+    bool isStopping;
+};
+
+// Public Methods:
+int GetDefaultNumberOfThreads();
+
+struct ThreadPool* CreateThreadPool(const int numberOfThreads);
+
+void RunInParallel(struct ThreadPool* pool, ParallelTask task, void* context);
+
+void RunTasksWithStealing(struct ThreadPool* pool, const int numberOfTasks, IndexedTask task, void* context);
+
+void DestroyThreadPool(struct ThreadPool* pool);
+
+#endif
\ No newline at end of file
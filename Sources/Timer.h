@@ -0,0 +1,64 @@
+#ifndef __TIMER_H__
+#define __TIMER_H__
+#include <time.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+/**
+ * @brief Get a monotonic timestamp in milliseconds
+ * ! Complexity: O(1)
+ * @return double 
+ */
+static inline double NowInMilliseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+}
+
+/**
+ * @brief Open a hardware counter of the cache misses of this thread, counting from now on.
+ * Kernels without perf events or with perf_event_paranoid set too high refuse it.
+ * ! Complexity: O(1)
+ * @return int the counter, or -1 if unavailable
+ */
+static inline int OpenCacheMissCounter()
+{
+    struct perf_event_attr attributes;
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.size = sizeof(attributes);
+    attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    return (int) syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+
+/**
+ * @brief Read the count of a counter opened with OpenCacheMissCounter
+ * ! Complexity: O(1)
+ * @param counter 
+ * @return long long the count, or -1 if the counter is unavailable
+ */
+static inline long long ReadCounter(const int counter)
+{
+    long long count;
+    if (counter < 0 || read(counter, &count, sizeof(count)) != sizeof(count))
+        return -1;
+    return count;
+}
+
+/**
+ * @brief Close a counter opened with OpenCacheMissCounter
+ * ! Complexity: O(1)
+ * @param counter 
+ */
+static inline void CloseCounter(const int counter)
+{
+    if (counter >= 0)
+        close(counter);
+}
+
+#endif
\ No newline at end of file